@@ -0,0 +1,762 @@
+// Copyright 2026 kirzo
+
+#include "Bindings/ScriptableBindingPlan.h"
+#include "Bindings/ScriptablePropertyRef.h"
+#include "PropertyBindingPath.h"
+#include "PropertyBindingDataView.h"
+#include "StructUtils/PropertyBag.h"
+#include <atomic>
+
+namespace ScriptableBindingPlan
+{
+	/** Finds a property or a getter function by name on the given struct. */
+	static bool FindMember(const UStruct* Struct, const FName Name, const FProperty*& OutProperty, UFunction*& OutFunction)
+	{
+		OutProperty = Struct->FindPropertyByName(Name);
+		OutFunction = nullptr;
+
+		if (!OutProperty)
+		{
+			if (const UClass* Class = Cast<UClass>(Struct))
+			{
+				OutFunction = Class->FindFunctionByName(Name);
+			}
+		}
+
+		return OutProperty || OutFunction;
+	}
+
+	/**
+	 * Returns the native thunk of a C++ getter that can be called directly.
+	 * Only parameterless native BlueprintPure functions qualify. Blueprint functions, events and const functions
+	 * that are merely BlueprintCallable keep using ProcessEvent.
+	 */
+	static FNativeFuncPtr FindNativeGetter(const UFunction* Function)
+	{
+		if (!Function->HasAllFunctionFlags(FUNC_Native | FUNC_BlueprintPure) || Function->HasAnyFunctionFlags(FUNC_BlueprintEvent | FUNC_Net))
+		{
+			return nullptr;
+		}
+
+		// The return value must be the only parameter
+		if (Function->NumParms != 1 || !Function->GetReturnProperty())
+		{
+			return nullptr;
+		}
+
+		return Function->GetNativeFunc();
+	}
+}
+
+// ------------------------------------------------------------------------------------------------
+// Scratch frames
+// ------------------------------------------------------------------------------------------------
+
+namespace ScriptableBindingPlan
+{
+	/** Blocks are at least this big, enough for a few dozen getter frames. */
+	static constexpr int32 MinScratchBlockSize = 4096;
+	static constexpr int32 ScratchBlockAlignment = 16;
+}
+
+FScriptableBindingScratch& FScriptableBindingScratch::Get()
+{
+	static thread_local FScriptableBindingScratch Scratch;
+	return Scratch;
+}
+
+FScriptableBindingScratch::~FScriptableBindingScratch()
+{
+	check(Frames.IsEmpty());
+
+	for (FBlock& Block : Blocks)
+	{
+		FMemory::Free(Block.Memory);
+	}
+}
+
+FScriptableBindingScratch::FScope::FScope()
+	: Scratch(FScriptableBindingScratch::Get())
+	, BlockIndex(Scratch.CurrentBlock)
+	, BlockOffset(Scratch.CurrentOffset)
+	, NumFrames(Scratch.Frames.Num())
+{
+}
+
+FScriptableBindingScratch::FScope::~FScope()
+{
+	Scratch.PopTo(BlockIndex, BlockOffset, NumFrames);
+}
+
+bool FScriptableBindingScratch::HasTrivialParameters(const UFunction* Function)
+{
+	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	{
+		if (!It->HasAllPropertyFlags(CPF_ZeroConstructor | CPF_NoDestructor))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+uint8* FScriptableBindingScratch::PushFrame(const UFunction* Function, bool bTrivialParms)
+{
+	using namespace ScriptableBindingPlan;
+
+	const int32 Size = FMath::Max<int32>(Function->ParmsSize, 1);
+	const int32 Alignment = FMath::Max<int32>(Function->GetMinAlignment(), 1);
+
+	uint8* Memory = nullptr;
+
+	// Find room in the current block or move on to the next one. Blocks never move, earlier frames stay valid.
+	while (!Memory)
+	{
+		if (!Blocks.IsValidIndex(CurrentBlock))
+		{
+			FBlock& NewBlock = Blocks.AddDefaulted_GetRef();
+			NewBlock.Size = FMath::Max(MinScratchBlockSize, Size + Alignment);
+			NewBlock.Memory = static_cast<uint8*>(FMemory::Malloc(NewBlock.Size, ScratchBlockAlignment));
+		}
+
+		const FBlock& Block = Blocks[CurrentBlock];
+		uint8* Candidate = Align(Block.Memory + CurrentOffset, Alignment);
+
+		if (Candidate + Size <= Block.Memory + Block.Size)
+		{
+			Memory = Candidate;
+			CurrentOffset = static_cast<int32>((Candidate + Size) - Block.Memory);
+		}
+		else if (Size + Alignment > Block.Size && CurrentOffset == 0)
+		{
+			// Too small even when empty, replace it with a bigger one
+			FMemory::Free(Blocks[CurrentBlock].Memory);
+			Blocks.RemoveAt(CurrentBlock);
+		}
+		else
+		{
+			++CurrentBlock;
+			CurrentOffset = 0;
+		}
+	}
+
+	if (bTrivialParms)
+	{
+		FMemory::Memzero(Memory, Size);
+	}
+	else
+	{
+		for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			It->InitializeValue_InContainer(Memory);
+		}
+		Frames.Add({ Function, Memory });
+	}
+
+	return Memory;
+}
+
+void FScriptableBindingScratch::PopTo(int32 InBlockIndex, int32 InBlockOffset, int32 InNumFrames)
+{
+	// Destroy in reverse order, nested frames first
+	for (int32 i = Frames.Num() - 1; i >= InNumFrames; --i)
+	{
+		const FFrame& Frame = Frames[i];
+		for (TFieldIterator<FProperty> It(Frame.Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			It->DestroyValue_InContainer(Frame.Memory);
+		}
+	}
+
+	Frames.SetNum(InNumFrames, EAllowShrinking::No);
+	CurrentBlock = InBlockIndex;
+	CurrentOffset = InBlockOffset;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Path plans
+// ------------------------------------------------------------------------------------------------
+
+void FScriptableBindingPathPlan::Reset()
+{
+	LeafProperty = nullptr;
+	Segments.Reset();
+	RootStruct.Reset();
+	CompileResult = EScriptableBindingCompileResult::Retry;
+	bOwnedMemoryOnly = false;
+	bCallsFunction = false;
+}
+
+EScriptableBindingCompileResult FScriptableBindingPathPlan::Compile(const FPropertyBindingPath& Path, const FPropertyBindingDataView& View)
+{
+	using namespace ScriptableBindingPlan;
+
+	Reset();
+
+	if (!View.IsValid())
+	{
+		return CompileResult;
+	}
+
+	RootStruct = View.GetStruct();
+
+	if (Path.IsPathEmpty())
+	{
+		CompileResult = EScriptableBindingCompileResult::Invalid;
+		return CompileResult;
+	}
+
+	// Helper to leave the plan in a consistent state on early outs
+	auto Fail = [this](EScriptableBindingCompileResult Result)
+	{
+		LeafProperty = nullptr;
+		Segments.Reset();
+		CompileResult = Result;
+		return Result;
+	};
+
+	const UStruct* CurrentStruct = View.GetStruct();
+	void* CurrentAddr = View.GetMutableMemory();
+
+	// Runtime class of the last object hop. Members declared on it (and not on the static type) are still reachable.
+	const UStruct* RuntimeStruct = nullptr;
+	bool bAfterNullObject = false;
+
+	// Function return values are kept alive while we keep discovering the layout behind them
+	FScriptableBindingScratch::FScope ScratchScope;
+
+	const int32 NumSegments = Path.NumSegments();
+	for (int32 i = 0; i < NumSegments; ++i)
+	{
+		const FPropertyBindingPathSegment& PathSegment = Path.GetSegment(i);
+		FScriptableBindingSegment& Segment = Segments.AddDefaulted_GetRef();
+
+		const FProperty* Prop = nullptr;
+		UFunction* Func = nullptr;
+
+		if (!FindMember(CurrentStruct, PathSegment.GetName(), Prop, Func))
+		{
+			if (RuntimeStruct && RuntimeStruct != CurrentStruct && FindMember(RuntimeStruct, PathSegment.GetName(), Prop, Func))
+			{
+				// Only objects of the derived class own this member, so the walk must check the class
+				Segment.RequiredClass = Prop ? Prop->GetOwnerClass() : Func->GetOwnerClass();
+			}
+			else
+			{
+				// A null object hides its runtime class, the member may still show up later
+				return Fail(bAfterNullObject ? EScriptableBindingCompileResult::Retry : EScriptableBindingCompileResult::Invalid);
+			}
+		}
+
+		void* ValueAddr = nullptr;
+
+		if (Func)
+		{
+			const FProperty* ReturnProp = Func->GetReturnProperty();
+			if (!ReturnProp)
+			{
+				return Fail(EScriptableBindingCompileResult::Invalid);
+			}
+
+			Segment.Function = Func;
+			Segment.bVirtualFunction = Func->HasAnyFunctionFlags(FUNC_BlueprintEvent);
+			Segment.bTrivialParms = FScriptableBindingScratch::HasTrivialParameters(Func);
+			Segment.NativeGetter = Segment.bVirtualFunction ? nullptr : FindNativeGetter(Func);
+			Prop = ReturnProp;
+
+			// Only execute the getter if there is more path to discover behind it
+			if (CurrentAddr && i < NumSegments - 1)
+			{
+				uint8* Parms = FScriptableBindingScratch::Get().PushFrame(Func, Segment.bTrivialParms);
+				static_cast<UObject*>(CurrentAddr)->ProcessEvent(Func, Parms);
+				ValueAddr = ReturnProp->ContainerPtrToValuePtr<void>(Parms);
+			}
+		}
+		else
+		{
+			Segment.Offset = Prop->GetOffset_ForInternal();
+			ValueAddr = CurrentAddr ? Prop->ContainerPtrToValuePtr<void>(CurrentAddr) : nullptr;
+
+			if (PathSegment.GetArrayIndex() != INDEX_NONE)
+			{
+				const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Prop);
+				if (!ArrayProp)
+				{
+					return Fail(EScriptableBindingCompileResult::Invalid);
+				}
+
+				Segment.ArrayProperty = ArrayProp;
+				Segment.ArrayIndex = PathSegment.GetArrayIndex();
+
+				if (ValueAddr)
+				{
+					FScriptArrayHelper Helper(ArrayProp, ValueAddr);
+					ValueAddr = Helper.IsValidIndex(Segment.ArrayIndex) ? Helper.GetRawPtr(Segment.ArrayIndex) : nullptr;
+				}
+
+				Prop = ArrayProp->Inner;
+			}
+		}
+
+		Segment.Property = Prop;
+
+		// Last segment, the plan is complete
+		if (i == NumSegments - 1)
+		{
+			Segment.Hop = EScriptableBindingHop::None;
+			LeafProperty = Prop;
+			CompileResult = EScriptableBindingCompileResult::Compiled;
+
+			bOwnedMemoryOnly = !Segments.ContainsByPredicate([](const FScriptableBindingSegment& Other)
+				{
+					return Other.Function || Other.Hop == EScriptableBindingHop::Object;
+				});
+			bCallsFunction = Segments.ContainsByPredicate([](const FScriptableBindingSegment& Other) { return Other.Function != nullptr; });
+
+			return CompileResult;
+		}
+
+		RuntimeStruct = nullptr;
+		bAfterNullObject = false;
+
+		// Prepare the next segment
+		if (const FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+		{
+			if (StructProp->Struct == FInstancedPropertyBag::StaticStruct())
+			{
+				// The bag layout only exists in memory, we need a live value to compile through it
+				FInstancedPropertyBag* Bag = static_cast<FInstancedPropertyBag*>(ValueAddr);
+				if (!Bag || !Bag->IsValid())
+				{
+					return Fail(EScriptableBindingCompileResult::Retry);
+				}
+
+				Segment.Hop = EScriptableBindingHop::PropertyBag;
+				Segment.ExpectedBagStruct = Bag->GetPropertyBagStruct();
+
+				CurrentStruct = Bag->GetPropertyBagStruct();
+				CurrentAddr = Bag->GetMutableValue().GetMemory();
+			}
+			else
+			{
+				Segment.Hop = EScriptableBindingHop::Struct;
+
+				CurrentStruct = StructProp->Struct;
+				CurrentAddr = ValueAddr;
+			}
+		}
+		else if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Prop))
+		{
+			Segment.Hop = EScriptableBindingHop::Object;
+
+			UObject* Obj = ValueAddr ? ObjProp->GetObjectPropertyValue(ValueAddr) : nullptr;
+
+			// Compile against the declared class so the plan holds for any instance
+			CurrentStruct = ObjProp->PropertyClass;
+			CurrentAddr = Obj;
+			RuntimeStruct = Obj ? Obj->GetClass() : nullptr;
+			bAfterNullObject = (Obj == nullptr);
+		}
+		else
+		{
+			// We hit a primitive type but the path still has more segments
+			return Fail(EScriptableBindingCompileResult::Invalid);
+		}
+	}
+
+	return Fail(EScriptableBindingCompileResult::Invalid);
+}
+
+bool FScriptableBindingPathPlan::GetStaticOffset(int32& OutOffset) const
+{
+	if (CompileResult != EScriptableBindingCompileResult::Compiled)
+	{
+		return false;
+	}
+
+	int32 Offset = 0;
+	for (const FScriptableBindingSegment& Segment : Segments)
+	{
+		const bool bPlainProperty = !Segment.Function && !Segment.ArrayProperty && Segment.RequiredClass.IsExplicitlyNull();
+		if (!bPlainProperty || (Segment.Hop != EScriptableBindingHop::Struct && Segment.Hop != EScriptableBindingHop::None))
+		{
+			return false;
+		}
+		Offset += Segment.Offset;
+	}
+
+	OutOffset = Offset;
+	return true;
+}
+
+void* FScriptableBindingPathPlan::Walk(void* RootMemory, FScriptableBindingScratch& Scratch, bool& bOutStale) const
+{
+	uint8* CurrentAddr = static_cast<uint8*>(RootMemory);
+
+	for (const FScriptableBindingSegment& Segment : Segments)
+	{
+		if (!CurrentAddr)
+		{
+			return nullptr;
+		}
+
+		if (!Segment.RequiredClass.IsExplicitlyNull())
+		{
+			const UClass* RequiredClass = Segment.RequiredClass.Get();
+			if (!RequiredClass || !reinterpret_cast<UObject*>(CurrentAddr)->IsA(RequiredClass))
+			{
+				return nullptr;
+			}
+		}
+
+		uint8* ValueAddr = nullptr;
+
+		if (Segment.Function)
+		{
+			UObject* Object = reinterpret_cast<UObject*>(CurrentAddr);
+
+			// Events may be overridden by the runtime class, same as a regular UFunction call
+			UFunction* Function = Segment.bVirtualFunction ? Object->FindFunction(Segment.Function->GetFName()) : Segment.Function;
+			if (!Function)
+			{
+				return nullptr;
+			}
+
+			// The frame is reused by the next resolve once the caller's scratch scope ends
+			uint8* Parms = Scratch.PushFrame(Function, Segment.bTrivialParms);
+			ValueAddr = Segment.Property->ContainerPtrToValuePtr<uint8>(Parms);
+
+			if (Segment.NativeGetter)
+			{
+				// Same as what ProcessEvent ends up doing for native functions, minus the VM and callspace overhead
+				FFrame Stack(Object, Function, Parms, nullptr, Function->ChildProperties);
+				Segment.NativeGetter(Object, Stack, ValueAddr);
+			}
+			else
+			{
+				Object->ProcessEvent(Function, Parms);
+			}
+		}
+		else
+		{
+			ValueAddr = CurrentAddr + Segment.Offset;
+
+			if (Segment.ArrayProperty)
+			{
+				FScriptArrayHelper Helper(Segment.ArrayProperty, ValueAddr);
+				if (!Helper.IsValidIndex(Segment.ArrayIndex))
+				{
+					return nullptr;
+				}
+				ValueAddr = Helper.GetRawPtr(Segment.ArrayIndex);
+			}
+		}
+
+		switch (Segment.Hop)
+		{
+			case EScriptableBindingHop::None:
+			return ValueAddr;
+
+			case EScriptableBindingHop::Struct:
+			CurrentAddr = ValueAddr;
+			break;
+
+			case EScriptableBindingHop::PropertyBag:
+			{
+				FInstancedPropertyBag* Bag = reinterpret_cast<FInstancedPropertyBag*>(ValueAddr);
+				if (Bag->GetPropertyBagStruct() != Segment.ExpectedBagStruct.Get())
+				{
+					// The bag was rebuilt with a different layout, our offsets are no longer valid
+					bOutStale = true;
+					return nullptr;
+				}
+				CurrentAddr = Bag->GetMutableValue().GetMemory();
+				break;
+			}
+
+			case EScriptableBindingHop::Object:
+			CurrentAddr = reinterpret_cast<uint8*>(static_cast<const FObjectPropertyBase*>(Segment.Property)->GetObjectPropertyValue(ValueAddr));
+			break;
+		}
+	}
+
+	return nullptr;
+}
+
+// ------------------------------------------------------------------------------------------------
+// Data versions
+// ------------------------------------------------------------------------------------------------
+
+uint64 FScriptableDataVersion::Allocate()
+{
+	// Starts at 1 so 0 can mean "never copied"
+	static std::atomic<uint64> NextVersion{ 1 };
+	return NextVersion.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ------------------------------------------------------------------------------------------------
+// Conversion kernels
+// ------------------------------------------------------------------------------------------------
+
+namespace ScriptableBindingPlan
+{
+	enum class ENumericType : uint8
+	{
+		Unknown,
+		Int8,
+		Int16,
+		Int32,
+		Int64,
+		UInt8,
+		UInt16,
+		UInt32,
+		UInt64,
+		Float,
+		Double
+	};
+
+	static ENumericType GetNumericType(const FProperty* Property)
+	{
+		if (Property->IsA<FFloatProperty>()) return ENumericType::Float;
+		if (Property->IsA<FDoubleProperty>()) return ENumericType::Double;
+		if (Property->IsA<FIntProperty>()) return ENumericType::Int32;
+		if (Property->IsA<FInt64Property>()) return ENumericType::Int64;
+		if (Property->IsA<FByteProperty>()) return ENumericType::UInt8;
+		if (Property->IsA<FInt8Property>()) return ENumericType::Int8;
+		if (Property->IsA<FInt16Property>()) return ENumericType::Int16;
+		if (Property->IsA<FUInt16Property>()) return ENumericType::UInt16;
+		if (Property->IsA<FUInt32Property>()) return ENumericType::UInt32;
+		if (Property->IsA<FUInt64Property>()) return ENumericType::UInt64;
+		return ENumericType::Unknown;
+	}
+
+	static void CopyNone(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+	}
+
+	static void CopyMemcpy(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		FMemory::Memcpy(TargetAddr, SourceAddr, Conversion.Size);
+	}
+
+	static void CopyValue(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		Conversion.SourceProperty->CopyCompleteValue(TargetAddr, SourceAddr);
+	}
+
+	static void CopyBool(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const bool bValue = static_cast<const FBoolProperty*>(Conversion.SourceProperty)->GetPropertyValue(SourceAddr);
+		static_cast<const FBoolProperty*>(Conversion.TargetProperty)->SetPropertyValue(TargetAddr, bValue);
+	}
+
+	static void CopyObject(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		// This gets the UObject* regardless of whether it's stored as TObjectPtr or raw pointer
+		UObject* SourceObject = static_cast<const FObjectPropertyBase*>(Conversion.SourceProperty)->GetObjectPropertyValue(SourceAddr);
+		static_cast<const FObjectPropertyBase*>(Conversion.TargetProperty)->SetObjectPropertyValue(TargetAddr, SourceObject);
+	}
+
+	static void CopyObjectChecked(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const FObjectPropertyBase* TargetObjectProperty = static_cast<const FObjectPropertyBase*>(Conversion.TargetProperty);
+		UObject* SourceObject = static_cast<const FObjectPropertyBase*>(Conversion.SourceProperty)->GetObjectPropertyValue(SourceAddr);
+
+		if (!SourceObject || SourceObject->IsA(TargetObjectProperty->PropertyClass))
+		{
+			TargetObjectProperty->SetObjectPropertyValue(TargetAddr, SourceObject);
+		}
+	}
+
+	static void CopyObjectToBool(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const UObject* SourceObject = static_cast<const FObjectPropertyBase*>(Conversion.SourceProperty)->GetObjectPropertyValue(SourceAddr);
+		static_cast<const FBoolProperty*>(Conversion.TargetProperty)->SetPropertyValue(TargetAddr, SourceObject != nullptr);
+	}
+
+	static void CopyReference(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		static_cast<FScriptablePropertyRef*>(TargetAddr)->Set(Conversion.SourceProperty, SourceAddr);
+	}
+
+	template<typename TSource, typename TTarget>
+	static void CopyNumeric(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		// Same intermediate types as the FNumericProperty accessors (double for floating point, int64 for integers)
+		using TIntermediate = std::conditional_t<std::is_floating_point_v<TSource>, double, int64>;
+		*static_cast<TTarget*>(TargetAddr) = static_cast<TTarget>(static_cast<TIntermediate>(*static_cast<const TSource*>(SourceAddr)));
+	}
+
+	/** Fallback for numeric properties without a typed kernel. */
+	static void CopyNumericGeneric(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const FNumericProperty* SourceNumeric = static_cast<const FNumericProperty*>(Conversion.SourceProperty);
+		const FNumericProperty* TargetNumeric = static_cast<const FNumericProperty*>(Conversion.TargetProperty);
+
+		if (SourceNumeric->IsFloatingPoint())
+		{
+			const double Value = SourceNumeric->GetFloatingPointPropertyValue(SourceAddr);
+			if (TargetNumeric->IsFloatingPoint()) TargetNumeric->SetFloatingPointPropertyValue(TargetAddr, Value);
+			else TargetNumeric->SetIntPropertyValue(TargetAddr, (int64)Value);
+		}
+		else
+		{
+			const int64 Value = SourceNumeric->GetSignedIntPropertyValue(SourceAddr);
+			if (TargetNumeric->IsFloatingPoint()) TargetNumeric->SetFloatingPointPropertyValue(TargetAddr, (double)Value);
+			else TargetNumeric->SetIntPropertyValue(TargetAddr, Value);
+		}
+	}
+
+	static void CopyBoolToNumeric(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const FNumericProperty* TargetNumeric = static_cast<const FNumericProperty*>(Conversion.TargetProperty);
+		const bool bValue = static_cast<const FBoolProperty*>(Conversion.SourceProperty)->GetPropertyValue(SourceAddr);
+
+		if (TargetNumeric->IsFloatingPoint()) TargetNumeric->SetFloatingPointPropertyValue(TargetAddr, bValue ? 1.0 : 0.0);
+		else TargetNumeric->SetIntPropertyValue(TargetAddr, int64(bValue ? 1 : 0));
+	}
+
+	static void CopyNumericToBool(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr)
+	{
+		const FNumericProperty* SourceNumeric = static_cast<const FNumericProperty*>(Conversion.SourceProperty);
+
+		bool bResult = false;
+		if (SourceNumeric->IsFloatingPoint()) bResult = !FMath::IsNearlyZero(SourceNumeric->GetFloatingPointPropertyValue(SourceAddr));
+		else bResult = (SourceNumeric->GetSignedIntPropertyValue(SourceAddr) != 0);
+
+		static_cast<const FBoolProperty*>(Conversion.TargetProperty)->SetPropertyValue(TargetAddr, bResult);
+	}
+
+	template<typename TSource>
+	static FScriptableBindingConversion::FKernel SelectNumericKernel(ENumericType TargetType)
+	{
+		switch (TargetType)
+		{
+			case ENumericType::Int8: return &CopyNumeric<TSource, int8>;
+			case ENumericType::Int16: return &CopyNumeric<TSource, int16>;
+			case ENumericType::Int32: return &CopyNumeric<TSource, int32>;
+			case ENumericType::Int64: return &CopyNumeric<TSource, int64>;
+			case ENumericType::UInt8: return &CopyNumeric<TSource, uint8>;
+			case ENumericType::UInt16: return &CopyNumeric<TSource, uint16>;
+			case ENumericType::UInt32: return &CopyNumeric<TSource, uint32>;
+			case ENumericType::UInt64: return &CopyNumeric<TSource, uint64>;
+			case ENumericType::Float: return &CopyNumeric<TSource, float>;
+			case ENumericType::Double: return &CopyNumeric<TSource, double>;
+			default: return &CopyNumericGeneric;
+		}
+	}
+
+	static FScriptableBindingConversion::FKernel SelectNumericKernel(ENumericType SourceType, ENumericType TargetType)
+	{
+		switch (SourceType)
+		{
+			case ENumericType::Int8: return SelectNumericKernel<int8>(TargetType);
+			case ENumericType::Int16: return SelectNumericKernel<int16>(TargetType);
+			case ENumericType::Int32: return SelectNumericKernel<int32>(TargetType);
+			case ENumericType::Int64: return SelectNumericKernel<int64>(TargetType);
+			case ENumericType::UInt8: return SelectNumericKernel<uint8>(TargetType);
+			case ENumericType::UInt16: return SelectNumericKernel<uint16>(TargetType);
+			case ENumericType::UInt32: return SelectNumericKernel<uint32>(TargetType);
+			case ENumericType::UInt64: return SelectNumericKernel<uint64>(TargetType);
+			case ENumericType::Float: return SelectNumericKernel<float>(TargetType);
+			case ENumericType::Double: return SelectNumericKernel<double>(TargetType);
+			default: return &CopyNumericGeneric;
+		}
+	}
+}
+
+void FScriptableBindingConversion::Select(const FProperty* InSourceProperty, const FProperty* InTargetProperty)
+{
+	using namespace ScriptableBindingPlan;
+
+	SourceProperty = InSourceProperty;
+	TargetProperty = InTargetProperty;
+	Kernel = &CopyNone;
+	Size = 0;
+	Kind = EScriptableBindingConversion::None;
+
+	if (!SourceProperty || !TargetProperty)
+	{
+		return;
+	}
+
+	// Identical Types (Fast Copy)
+	if (SourceProperty->SameType(TargetProperty))
+	{
+		if (SourceProperty->IsA<FBoolProperty>())
+		{
+			// Bitfields may use different masks, go through the property
+			Kernel = &CopyBool;
+			Kind = EScriptableBindingConversion::Bool;
+		}
+		else if (SourceProperty->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			Kernel = &CopyMemcpy;
+			Kind = EScriptableBindingConversion::Memcpy;
+			Size = SourceProperty->GetSize();
+		}
+		else
+		{
+			Kernel = &CopyValue;
+			Kind = EScriptableBindingConversion::CopyValue;
+		}
+		return;
+	}
+
+	// Read-only References (point to the source value instead of copying it)
+	if (FScriptablePropertyRef::IsRefProperty(TargetProperty))
+	{
+		if (!FScriptablePropertyRef::IsRefProperty(SourceProperty))
+		{
+			Kernel = &CopyReference;
+			Kind = EScriptableBindingConversion::Reference;
+		}
+		return;
+	}
+
+	// Object Reference Handling (TObjectPtr <-> Raw Ptr, Child -> Parent)
+	if (const FObjectPropertyBase* SourceObject = CastField<FObjectPropertyBase>(SourceProperty))
+	{
+		if (const FObjectPropertyBase* TargetObject = CastField<FObjectPropertyBase>(TargetProperty))
+		{
+			// Any value of a child class fits the target, no need to check each object
+			const bool bAlwaysCompatible = SourceObject->PropertyClass && SourceObject->PropertyClass->IsChildOf(TargetObject->PropertyClass);
+			Kernel = bAlwaysCompatible ? &CopyObject : &CopyObjectChecked;
+			Kind = EScriptableBindingConversion::Object;
+		}
+		else if (TargetProperty->IsA<FBoolProperty>())
+		{
+			Kernel = &CopyObjectToBool;
+			Kind = EScriptableBindingConversion::ObjectToBool;
+		}
+		return;
+	}
+
+	const bool bSourceNumeric = SourceProperty->IsA<FNumericProperty>();
+	const bool bTargetNumeric = TargetProperty->IsA<FNumericProperty>();
+
+	// Numeric <-> Numeric Conversion
+	if (bSourceNumeric && bTargetNumeric)
+	{
+		Kernel = SelectNumericKernel(GetNumericType(SourceProperty), GetNumericType(TargetProperty));
+		Kind = EScriptableBindingConversion::Numeric;
+	}
+	// Bool -> Numeric (True=1, False=0)
+	else if (SourceProperty->IsA<FBoolProperty>() && bTargetNumeric)
+	{
+		Kernel = &CopyBoolToNumeric;
+		Kind = EScriptableBindingConversion::BoolToNumeric;
+	}
+	// Numeric -> Bool (0=False, !=0 True)
+	else if (bSourceNumeric && TargetProperty->IsA<FBoolProperty>())
+	{
+		Kernel = &CopyNumericToBool;
+		Kind = EScriptableBindingConversion::NumericToBool;
+	}
+}
+
+void FScriptableBindingConversion::Disable()
+{
+	Kernel = &ScriptableBindingPlan::CopyNone;
+	Kind = EScriptableBindingConversion::None;
+}
@@ -0,0 +1,167 @@
+// Copyright 2026 kirzo
+
+#include "Bindings/ScriptableBindingSubsystem.h"
+#include "ScriptableObject.h"
+#include "Engine/World.h"
+
+void FScriptableBindingTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FScriptableBindingTickFunction::ExecuteTick);
+
+	if (IsValid(Target))
+	{
+		Target->ResolveTickBindings();
+	}
+}
+
+FString FScriptableBindingTickFunction::DiagnosticMessage()
+{
+	return TEXT("UScriptableBindingSubsystem[ResolveTickBindings]");
+}
+
+FName FScriptableBindingTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("ScriptableBindingSubsystem"));
+}
+
+void UScriptableBindingSubsystem::PostInitialize()
+{
+	Super::PostInitialize();
+
+	UWorld* World = GetWorld();
+	if (World && World->PersistentLevel)
+	{
+		// Only enabled while there are objects to resolve
+		TickFunction.Target = this;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = false;
+		TickFunction.TickGroup = TG_PrePhysics;
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+}
+
+void UScriptableBindingSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	TickFunction.Target = nullptr;
+	Depths.Empty();
+	Slots.Empty();
+
+	Super::Deinitialize();
+}
+
+void UScriptableBindingSubsystem::AddTickBindings(UScriptableObject* Object)
+{
+	if (!Object || Slots.Contains(Object))
+	{
+		return;
+	}
+
+	const int32 Depth = Object->GetBindingDepth();
+	if (!Depths.IsValidIndex(Depth))
+	{
+		Depths.SetNum(Depth + 1);
+	}
+
+	Slots.Add(Object, { Depth, Depths[Depth].Objects.Add(Object) });
+
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(true);
+
+		// Scheduled objects tick from a group tick function, which already depends on this one
+		if (!Object->IsTickScheduled())
+		{
+			Object->PrimaryObjectTick.AddPrerequisite(this, TickFunction);
+		}
+	}
+}
+
+void UScriptableBindingSubsystem::RemoveTickBindings(UScriptableObject* Object)
+{
+	FSlot Slot;
+	if (!Slots.RemoveAndCopyValue(Object, Slot))
+	{
+		return;
+	}
+
+	TArray<TObjectPtr<UScriptableObject>>& Objects = Depths[Slot.Depth].Objects;
+	if (bResolving)
+	{
+		// Indices must not move under ResolveTickBindings
+		Objects[Slot.Index] = nullptr;
+		bNeedsCompact = true;
+	}
+	else
+	{
+		Objects.RemoveAtSwap(Slot.Index, EAllowShrinking::No);
+		if (Objects.IsValidIndex(Slot.Index) && Objects[Slot.Index])
+		{
+			Slots[Objects[Slot.Index].Get()].Index = Slot.Index;
+		}
+	}
+
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		Object->PrimaryObjectTick.RemovePrerequisite(this, TickFunction);
+
+		if (Slots.IsEmpty())
+		{
+			TickFunction.SetTickFunctionEnable(false);
+		}
+	}
+}
+
+void UScriptableBindingSubsystem::AddTickPrerequisite(FTickFunction& InTickFunction)
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		InTickFunction.AddPrerequisite(this, TickFunction);
+	}
+}
+
+void UScriptableBindingSubsystem::ResolveTickBindings()
+{
+	{
+		TGuardValue<bool> ResolvingGuard(bResolving, true);
+
+		// Objects added meanwhile are appended, and resolved with the rest
+		for (int32 Depth = 0; Depth < Depths.Num(); ++Depth)
+		{
+			for (int32 Index = 0; Index < Depths[Depth].Objects.Num(); ++Index)
+			{
+				UScriptableObject* Object = Depths[Depth].Objects[Index];
+				if (IsValid(Object) && Object->IsRegistered())
+				{
+					Object->ResolveTickBindings();
+				}
+			}
+		}
+	}
+
+	if (bNeedsCompact)
+	{
+		CompactDepths();
+	}
+}
+
+void UScriptableBindingSubsystem::CompactDepths()
+{
+	bNeedsCompact = false;
+
+	for (int32 Depth = 0; Depth < Depths.Num(); ++Depth)
+	{
+		TArray<TObjectPtr<UScriptableObject>>& Objects = Depths[Depth].Objects;
+		if (Objects.RemoveAll([](const TObjectPtr<UScriptableObject>& Object) { return !Object; }) > 0)
+		{
+			for (int32 Index = 0; Index < Objects.Num(); ++Index)
+			{
+				Slots[Objects[Index].Get()].Index = Index;
+			}
+		}
+	}
+}
@@ -1,183 +1,151 @@
 ﻿// Copyright 2026 kirzo
 
 #include "Bindings/ScriptablePropertyBindings.h"
+#include "Bindings/ScriptablePropertyRef.h"
 #include "PropertyBindingDataView.h"
 #include "ScriptableObject.h"
 #include "StructUtils/PropertyBag.h"
-#include "UObject/StructOnScope.h"
 
-// ------------------------------------------------------------------------------------------------
-// Helper to resolve paths manually, bypassing Unreal's native black-box function.
-// This supports diving into FInstancedPropertyBags no matter what parent struct they live inside.
-// ------------------------------------------------------------------------------------------------
-static bool ResolveIndirections(const FPropertyBindingPath& Path, const FPropertyBindingDataView& View, const FProperty*& OutProp, void*& OutAddr, TArray<TSharedPtr<FStructOnScope>>& OutTempMemoryArray)
-{
-	if (!View.IsValid() || Path.IsPathEmpty()) return false;
+#include "HAL/IConsoleManager.h"
+
+#if !UE_BUILD_SHIPPING
+#include "GameFramework/Actor.h"
+#include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "UObject/StrongObjectPtr.h"
+#endif
 
-	const UStruct* CurrentStruct = View.GetStruct();
-	void* CurrentAddr = View.GetMutableMemory();
+static bool GScriptableCoalesceBindingSpans = true;
+static FAutoConsoleVariableRef CVarScriptableCoalesceBindingSpans(
+	TEXT("Scriptable.Bindings.CoalesceSpans"),
+	GScriptableCoalesceBindingSpans,
+	TEXT("If true, contiguous POD bindings of the same source are copied with a single memcpy. Applied the next time bindings are compiled."));
 
-	for (int32 i = 0; i < Path.NumSegments(); ++i)
+#if WITH_EDITOR
+/** Hashes the names and array indices of the first NumSegments segments of the path. */
+static uint32 HashTargetPath(const FPropertyBindingPath& Path, int32 NumSegments)
+{
+	uint32 Hash = GetTypeHash(NumSegments);
+	for (int32 i = 0; i < NumSegments; ++i)
 	{
 		const FPropertyBindingPathSegment& Segment = Path.GetSegment(i);
+		Hash = HashCombineFast(Hash, GetTypeHash(Segment.GetName()));
+		Hash = HashCombineFast(Hash, GetTypeHash(Segment.GetArrayIndex()));
+	}
+	return Hash;
+}
 
-		// Find the property in the current struct context
-		const FProperty* Prop = CurrentStruct->FindPropertyByName(Segment.GetName());
+/** Returns true if Path goes through every segment of ParentPath and continues below it. */
+static bool IsChildPath(const FPropertyBindingPath& Path, const FPropertyBindingPath& ParentPath)
+{
+	// If the current binding has fewer or an equal number of segments compared to the Target, it cannot be a child.
+	if (Path.NumSegments() <= ParentPath.NumSegments())
+	{
+		return false;
+	}
 
-		// -----------------------------------------------------------------
-		// Function Fallback (Valid ANYWHERE in the chain)
-		// -----------------------------------------------------------------
-		if (!Prop)
+	// Verify if this binding's path starts exactly the same as our TargetPath.
+	for (int32 i = 0; i < ParentPath.NumSegments(); ++i)
+	{
+		const FPropertyBindingPathSegment& ParentSeg = ParentPath.GetSegment(i);
+		const FPropertyBindingPathSegment& ChildSeg = Path.GetSegment(i);
+
+		if (ParentSeg.GetName() != ChildSeg.GetName() || ParentSeg.GetArrayIndex() != ChildSeg.GetArrayIndex())
 		{
-			if (const UClass* CurrentClass = Cast<UClass>(CurrentStruct))
-			{
-				if (UFunction* Func = CurrentClass->FindFunctionByName(Segment.GetName()))
-				{
-					const FProperty* ReturnProp = Func->GetReturnProperty();
-					if (!ReturnProp) return false;
-
-					// Allocate memory for this function execution and keep it alive in the array
-					TSharedPtr<FStructOnScope> TempScope = MakeShared<FStructOnScope>(Func);
-					OutTempMemoryArray.Add(TempScope);
-
-					UObject* TargetObj = static_cast<UObject*>(CurrentAddr);
-					TargetObj->ProcessEvent(Func, TempScope->GetStructMemory());
-
-					// The memory for the next segment is the return value of the function
-					void* RetAddr = ReturnProp->ContainerPtrToValuePtr<void>(TempScope->GetStructMemory());
-
-					if (i == Path.NumSegments() - 1)
-					{
-						// It was the last segment in the chain!
-						OutProp = ReturnProp;
-						OutAddr = RetAddr;
-						return true;
-					}
-					else
-					{
-						// It's mid-path (e.g. GetTransform().Translation). Prepare for the next segment.
-						if (const FStructProperty* StructProp = CastField<FStructProperty>(ReturnProp))
-						{
-							CurrentStruct = StructProp->Struct;
-							CurrentAddr = RetAddr;
-							continue;
-						}
-						else if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(ReturnProp))
-						{
-							UObject* RetObj = ObjProp->GetObjectPropertyValue(RetAddr);
-							if (!RetObj) return false;
-							CurrentStruct = RetObj->GetClass();
-							CurrentAddr = RetObj;
-							continue;
-						}
-						else return false; // A primitive was returned but the path continues (Invalid)
-					}
-				}
-			}
-			return false; // Path is completely broken
+			return false; // Paths diverge, so it's not a child.
 		}
+	}
 
-		// Advance the memory pointer to this property
-		void* PropAddr = Prop->ContainerPtrToValuePtr<void>(CurrentAddr);
+	return true;
+}
 
-		// Handle Array indices if this segment targets an element
-		if (Segment.GetArrayIndex() != INDEX_NONE)
-		{
-			if (const FArrayProperty* ArrayProp = CastField<FArrayProperty>(Prop))
-			{
-				FScriptArrayHelper Helper(ArrayProp, PropAddr);
-				if (!Helper.IsValidIndex(Segment.GetArrayIndex())) return false;
-				PropAddr = Helper.GetRawPtr(Segment.GetArrayIndex());
-				Prop = ArrayProp->Inner;
-			}
-			else return false;
-		}
+void FScriptablePropertyBindings::EnsureTargetPathIndex() const
+{
+	if (bTargetPathIndexValid && IndexedNum == Bindings.Num())
+	{
+		return;
+	}
 
-		// If this is the final segment in the path, we have our target
-		if (i == Path.NumSegments() - 1)
-		{
-			OutProp = Prop;
-			OutAddr = PropAddr;
-			return true;
-		}
+	TargetPathIndex.Reset();
+	TargetPrefixIndex.Reset();
+	bTargetPathIndexValid = true;
+	IndexedNum = 0;
 
-		// If not the last segment, prepare CurrentStruct and CurrentAddr for the next loop iteration
-		if (const FStructProperty* StructProp = CastField<FStructProperty>(Prop))
-		{
-			// MAGIC: Generic detection of ANY InstancedPropertyBag hidden inside any struct
-			if (StructProp->Struct->GetFName() == TEXT("InstancedPropertyBag"))
-			{
-				FInstancedPropertyBag* Bag = static_cast<FInstancedPropertyBag*>(PropAddr);
-				if (!Bag || !Bag->IsValid()) return false;
+	for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+	{
+		IndexBinding(Index);
+	}
+}
 
-				// Swap our context to the dynamic struct and dynamic memory of the bag
-				CurrentStruct = Bag->GetPropertyBagStruct();
-				CurrentAddr = Bag->GetMutableValue().GetMemory();
-			}
-			else
-			{
-				// Standard struct traversal
-				CurrentStruct = StructProp->Struct;
-				CurrentAddr = PropAddr;
-			}
-		}
-		else if (const FObjectPropertyBase* ObjProp = CastField<FObjectPropertyBase>(Prop))
-		{
-			UObject* Obj = ObjProp->GetObjectPropertyValue(PropAddr);
-			if (!Obj) return false;
+void FScriptablePropertyBindings::IndexBinding(int32 BindingIndex) const
+{
+	const FPropertyBindingPath& TargetPath = Bindings[BindingIndex].TargetPath;
+	const int32 NumSegments = TargetPath.NumSegments();
 
-			// Standard UObject traversal
-			CurrentStruct = Obj->GetClass();
-			CurrentAddr = Obj;
-		}
-		else
-		{
-			// We hit a primitive type but the path still has more segments (invalid path)
-			return false;
-		}
+	TargetPathIndex.Add(HashTargetPath(TargetPath, NumSegments), BindingIndex);
+	for (int32 PrefixLength = 1; PrefixLength < NumSegments; ++PrefixLength)
+	{
+		TargetPrefixIndex.Add(HashTargetPath(TargetPath, PrefixLength), BindingIndex);
 	}
 
-	return false;
+	IndexedNum = FMath::Max(IndexedNum, BindingIndex + 1);
 }
 
-#if WITH_EDITOR
-void FScriptablePropertyBindings::AddPropertyBinding(const FPropertyBindingPath& SourcePath, const FPropertyBindingPath& TargetPath, bool bIsAutoBinding)
+int32 FScriptablePropertyBindings::FindBindingIndex(const FPropertyBindingPath& TargetPath) const
 {
-	// Sanitize
-	Bindings.RemoveAll([&TargetPath](const FScriptablePropertyBinding& Binding)
+	EnsureTargetPathIndex();
+
+	// Same result as a linear scan: the first binding with this target
+	int32 FoundIndex = INDEX_NONE;
+	for (TMultiMap<uint32, int32>::TConstKeyIterator It(TargetPathIndex, HashTargetPath(TargetPath, TargetPath.NumSegments())); It; ++It)
+	{
+		const int32 Index = It.Value();
+		if ((FoundIndex == INDEX_NONE || Index < FoundIndex) && Bindings[Index].TargetPath == TargetPath)
 		{
-			// If the current binding has fewer or an equal number of segments compared to the Target, it cannot be a child.
-			if (Binding.TargetPath.NumSegments() <= TargetPath.NumSegments())
-			{
-				return false;
-			}
+			FoundIndex = Index;
+		}
+	}
+	return FoundIndex;
+}
 
-			// Verify if this binding's path starts exactly the same as our TargetPath.
-			for (int32 i = 0; i < TargetPath.NumSegments(); ++i)
-			{
-				const FPropertyBindingPathSegment& ParentSeg = TargetPath.GetSegment(i);
-				const FPropertyBindingPathSegment& ChildSeg = Binding.TargetPath.GetSegment(i);
+void FScriptablePropertyBindings::FindChildBindings(const FPropertyBindingPath& TargetPath, TArray<int32, TInlineAllocator<8>>& OutIndices) const
+{
+	EnsureTargetPathIndex();
 
-				if (ParentSeg.GetName() != ChildSeg.GetName() || ParentSeg.GetArrayIndex() != ChildSeg.GetArrayIndex())
-				{
-					return false; // Paths diverge, so it's not a child.
-				}
-			}
+	for (TMultiMap<uint32, int32>::TConstKeyIterator It(TargetPrefixIndex, HashTargetPath(TargetPath, TargetPath.NumSegments())); It; ++It)
+	{
+		if (IsChildPath(Bindings[It.Value()].TargetPath, TargetPath))
+		{
+			OutIndices.Add(It.Value());
+		}
+	}
+}
 
-			// If all segments of the Target match the beginning of this binding, it's a child. Remove it!
-			return true;
-		});
+void FScriptablePropertyBindings::AddPropertyBinding(const FPropertyBindingPath& SourcePath, const FPropertyBindingPath& TargetPath, bool bIsAutoBinding)
+{
+	ResetCompiledBindings();
 
-	// If a binding already exists for this target, update it
-	for (FScriptablePropertyBinding& Binding : Bindings)
+	// Sanitize: a binding on the whole value replaces the bindings of its members
+	TArray<int32, TInlineAllocator<8>> ChildIndices;
+	FindChildBindings(TargetPath, ChildIndices);
+	if (ChildIndices.Num() > 0)
 	{
-		if (Binding.TargetPath == TargetPath)
+		ChildIndices.Sort(TGreater<int32>());
+		for (const int32 ChildIndex : ChildIndices)
 		{
-			Binding.SourcePath = SourcePath;
-			Binding.SourceID = SourcePath.GetStructID();
-			Binding.bIsAutoBinding = bIsAutoBinding;
-			return;
+			Bindings.RemoveAt(ChildIndex);
 		}
+		InvalidateTargetPathIndex();
+	}
+
+	// If a binding already exists for this target, update it
+	const int32 ExistingIndex = FindBindingIndex(TargetPath);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		FScriptablePropertyBinding& Binding = Bindings[ExistingIndex];
+		Binding.SourcePath = SourcePath;
+		Binding.SourceID = SourcePath.GetStructID();
+		Binding.bIsAutoBinding = bIsAutoBinding;
+		return;
 	}
 
 	// Otherwise, create a new one
@@ -186,10 +154,20 @@ void FScriptablePropertyBindings::AddPropertyBinding(const FPropertyBindingPath&
 	NewBinding.TargetPath = TargetPath;
 	NewBinding.SourceID = SourcePath.GetStructID();
 	NewBinding.bIsAutoBinding = bIsAutoBinding;
+
+	IndexBinding(Bindings.Num() - 1);
 }
 
 void FScriptablePropertyBindings::RemovePropertyBindings(const FPropertyBindingPath& TargetPath)
 {
+	if (FindBindingIndex(TargetPath) == INDEX_NONE)
+	{
+		return;
+	}
+
+	ResetCompiledBindings();
+	InvalidateTargetPathIndex();
+
 	Bindings.RemoveAll([&TargetPath](const FScriptablePropertyBinding& Binding)
 	{
 		return Binding.TargetPath == TargetPath;
@@ -198,30 +176,28 @@ void FScriptablePropertyBindings::RemovePropertyBindings(const FPropertyBindingP
 
 bool FScriptablePropertyBindings::HasPropertyBinding(const FPropertyBindingPath& TargetPath) const
 {
-	return Bindings.ContainsByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
-	{
-		return Binding.TargetPath == TargetPath;
-	});
+	return FindBindingIndex(TargetPath) != INDEX_NONE;
 }
 
 bool FScriptablePropertyBindings::HasManualPropertyBinding(const FPropertyBindingPath& TargetPath) const
 {
-	for (const FScriptablePropertyBinding& Binding : Bindings)
-	{
-		if (Binding.TargetPath == TargetPath)
-		{
-			return !Binding.bIsAutoBinding;
-		}
-	}
-	return false;
+	const int32 Index = FindBindingIndex(TargetPath);
+	return Index != INDEX_NONE && !Bindings[Index].bIsAutoBinding;
 }
 
 void FScriptablePropertyBindings::ClearAutoBindings()
 {
-	Bindings.RemoveAll([](const FScriptablePropertyBinding& Binding)
+	ResetCompiledBindings();
+
+	const int32 NumRemoved = Bindings.RemoveAll([](const FScriptablePropertyBinding& Binding)
 		{
 			return Binding.bIsAutoBinding;
 		});
+
+	if (NumRemoved > 0)
+	{
+		InvalidateTargetPathIndex();
+	}
 }
 
 void FScriptablePropertyBindings::SanitizeObsoleteBindings(UScriptableObject* TargetObject)
@@ -238,14 +214,12 @@ void FScriptablePropertyBindings::SanitizeObsoleteBindings(UScriptableObject* Ta
 	{
 		const FScriptablePropertyBinding& Binding = Bindings[i];
 
-		const FProperty* OutProp = nullptr;
-		void* OutAddr = nullptr;
-		TArray<TSharedPtr<FStructOnScope>> TempMemoryArray;
-
-		// If resolving the TargetPath fails, it means the variable or its parent struct has been deleted.
-		if (!ResolveIndirections(Binding.TargetPath, TargetView, OutProp, OutAddr, TempMemoryArray))
+		// If compiling the TargetPath fails, it means the variable or its parent struct has been deleted.
+		FScriptableBindingPathPlan TargetPlan;
+		if (TargetPlan.Compile(Binding.TargetPath, TargetView) != EScriptableBindingCompileResult::Compiled)
 		{
 			Bindings.RemoveAt(i);
+			InvalidateTargetPathIndex();
 		}
 	}
 }
@@ -254,6 +228,9 @@ void FScriptablePropertyBindings::HandleArrayElementRemoved(const FName& ArrayNa
 {
 	if (IndexRemoved < 0) return;
 
+	ResetCompiledBindings();
+	InvalidateTargetPathIndex();
+
 	// Iterate backwards to safely remove elements while iterating
 	for (int32 i = Bindings.Num() - 1; i >= 0; --i)
 	{
@@ -288,6 +265,9 @@ void FScriptablePropertyBindings::HandleArrayElementRemoved(const FName& ArrayNa
 
 void FScriptablePropertyBindings::HandleArrayClear(const FName& ArrayName)
 {
+	ResetCompiledBindings();
+	InvalidateTargetPathIndex();
+
 	Bindings.RemoveAll([&ArrayName](const FScriptablePropertyBinding& Binding)
 	{
 		if (Binding.TargetPath.NumSegments() > 0)
@@ -301,154 +281,671 @@ void FScriptablePropertyBindings::HandleArrayClear(const FName& ArrayName)
 
 const FPropertyBindingPath* FScriptablePropertyBindings::GetPropertyBinding(const FPropertyBindingPath& TargetPath) const
 {
-	const FScriptablePropertyBinding* FoundBinding = Bindings.FindByPredicate([&TargetPath](const FScriptablePropertyBinding& Binding)
+	const int32 Index = FindBindingIndex(TargetPath);
+	return Index != INDEX_NONE ? &Bindings[Index].SourcePath : nullptr;
+}
+
+bool FScriptablePropertyBindings::BakeResolvePolicies(const UScriptableObject* TargetObject)
+{
+	static const FName ResolveMetaName(TEXT("ScriptableResolve"));
+
+	if (!TargetObject) return false;
+
+	const UEnum* PolicyEnum = StaticEnum<EScriptableBindingResolvePolicy>();
+	bool bChanged = false;
+
+	for (FScriptablePropertyBinding& Binding : Bindings)
 	{
-		return Binding.TargetPath == TargetPath;
-	});
+		if (Binding.TargetPath.NumSegments() == 0) continue;
+
+		// The policy is declared on the root property of the target path
+		const FProperty* TargetProp = TargetObject->GetClass()->FindPropertyByName(Binding.TargetPath.GetSegment(0).GetName());
+		if (!TargetProp || !TargetProp->HasMetaData(ResolveMetaName)) continue;
+
+		const int64 Value = PolicyEnum->GetValueByNameString(TargetProp->GetMetaData(ResolveMetaName));
+		if (Value == INDEX_NONE)
+		{
+			UE_LOG(LogScriptableObject, Warning, TEXT("%s: Unknown ScriptableResolve policy '%s' on '%s'."), *TargetObject->GetName(), *TargetProp->GetMetaData(ResolveMetaName), *TargetProp->GetName());
+			continue;
+		}
 
-	return FoundBinding ? &FoundBinding->SourcePath : nullptr;
+		const EScriptableBindingResolvePolicy Policy = static_cast<EScriptableBindingResolvePolicy>(Value);
+		if (Binding.ResolvePolicy != Policy)
+		{
+			Binding.ResolvePolicy = Policy;
+			bChanged = true;
+		}
+	}
+
+	if (bChanged)
+	{
+		ResetCompiledBindings();
+	}
+
+	return bChanged;
 }
 #endif
 
-void FScriptablePropertyBindings::ResolveBindings(UScriptableObject* TargetObject)
+void FScriptablePropertyBindings::PostSerialize(const FArchive& Ar)
 {
-	if (!TargetObject) return;
-
-	// Prepare the Context View in advance (it might be used by multiple bindings)
-	const FInstancedPropertyBag* Context = TargetObject->GetContext();
+#if WITH_EDITOR
+	if (Ar.IsLoading())
+	{
+		InvalidateTargetPathIndex();
+	}
+#endif
+}
 
-	// Prepare Context View
+struct FScriptablePropertyBindings::FResolveScope
+{
+	FPropertyBindingDataView TargetView;
 	FPropertyBindingDataView ContextView;
+	const FScriptableDataVersion* ContextVersion = nullptr;
+
+	/** Looks up the sibling sources. Null for struct nodes. */
+	UScriptableObject* Object = nullptr;
+};
+
+static FPropertyBindingDataView MakeContextView(const FInstancedPropertyBag* Context)
+{
 	if (Context && Context->IsValid())
 	{
-		ContextView = FPropertyBindingDataView(Context->GetPropertyBagStruct(), const_cast<FInstancedPropertyBag*>(Context)->GetMutableValue().GetMemory());
+		return FPropertyBindingDataView(Context->GetPropertyBagStruct(), const_cast<FInstancedPropertyBag*>(Context)->GetMutableValue().GetMemory());
 	}
+	return FPropertyBindingDataView();
+}
 
-	// The Target View is always the object requesting the resolution
-	FPropertyBindingDataView TargetView(TargetObject);
+FPropertyBindingDataView FScriptablePropertyBindings::GetSourceView(const FScriptablePropertyBinding& Binding, FScriptableCompiledBinding& Compiled, const FResolveScope& Scope, uint64* OutSourceVersion)
+{
+	if (OutSourceVersion)
+	{
+		*OutSourceVersion = 0;
+	}
 
-	for (const FScriptablePropertyBinding& Binding : Bindings)
+	if (Binding.SourceID.IsValid())
 	{
-		// Determine the Source Data View (Who are we copying FROM?)
-		FPropertyBindingDataView SourceView;
-		if (Binding.SourceID.IsValid())
+		// CASE A: Sibling Binding
+		// Cached by CompileBindings, otherwise direct lookup via the injected map in TargetObject
+		UScriptableObject* SourceObj = Compiled.SourceObject.Get();
+		if (!SourceObj && Scope.Object)
+		{
+			SourceObj = Scope.Object->FindBindingSource(Binding.SourceID);
+			Compiled.SourceObject = SourceObj;
+		}
+
+		if (SourceObj)
 		{
-			// CASE A: Sibling Binding
-			// Direct lookup via the injected map in TargetObject
-			if (UScriptableObject* SourceObj = TargetObject->FindBindingSource(Binding.SourceID))
+			if (OutSourceVersion)
 			{
-				SourceView = FPropertyBindingDataView(SourceObj);
+				*OutSourceVersion = SourceObj->GetOutputVersion().Get();
 			}
-			else
+			return FPropertyBindingDataView(SourceObj);
+		}
+
+		// Source object not found (e.g., was deleted or not loaded yet).
+		return FPropertyBindingDataView();
+	}
+
+	// CASE B: Context Binding
+	if (OutSourceVersion && Scope.ContextVersion)
+	{
+		*OutSourceVersion = Scope.ContextVersion->Get();
+	}
+	return Scope.ContextView;
+}
+
+static FString GetTargetName(const FPropertyBindingDataView& TargetView)
+{
+	if (TargetView.GetStruct() && TargetView.GetStruct()->IsA<UClass>())
+	{
+		return static_cast<const UObject*>(TargetView.GetMemory())->GetName();
+	}
+	return TargetView.GetStruct() ? TargetView.GetStruct()->GetName() : FString();
+}
+
+/** Compiles the plan if it was never compiled for this layout, or if it is waiting for runtime memory. */
+static bool EnsureCompiled(FScriptableBindingPathPlan& Plan, const FPropertyBindingPath& Path, const FPropertyBindingDataView& View)
+{
+	if (!Plan.IsCompiledFor(View.GetStruct()) || Plan.CompileResult == EScriptableBindingCompileResult::Retry)
+	{
+		Plan.Compile(Path, View);
+	}
+	return Plan.CompileResult == EScriptableBindingCompileResult::Compiled;
+}
+
+/** Walks a compiled plan, recompiling it once if a nested bag changed its layout. */
+static void* WalkPlan(FScriptableBindingPathPlan& Plan, const FPropertyBindingPath& Path, const FPropertyBindingDataView& View, FScriptableBindingScratch& Scratch)
+{
+	bool bStale = false;
+	void* Addr = Plan.Walk(View.GetMutableMemory(), Scratch, bStale);
+
+	if (bStale && Plan.Compile(Path, View) == EScriptableBindingCompileResult::Compiled)
+	{
+		bStale = false;
+		Addr = Plan.Walk(View.GetMutableMemory(), Scratch, bStale);
+	}
+
+	return Addr;
+}
+
+/** Selects the conversion of a binding. References into getter return values are refused, as those only live until the copy is done. */
+static void SelectConversion(FScriptableCompiledBinding& Compiled, const FPropertyBindingDataView& TargetView)
+{
+	Compiled.Conversion.Select(Compiled.Source.LeafProperty, Compiled.Target.LeafProperty);
+
+	if (Compiled.Conversion.Kind == EScriptableBindingConversion::Reference && Compiled.Source.bCallsFunction)
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("%s: '%s' cannot reference the return value of a function. Bind it to a property instead."),
+			*GetTargetName(TargetView), *Compiled.Target.LeafProperty->GetName());
+		Compiled.Conversion.Disable();
+	}
+}
+
+/** Scope of the bindings of an object: the object itself, and the Context and siblings it was given. */
+static FScriptablePropertyBindings::FResolveScope MakeObjectScope(UScriptableObject* TargetObject)
+{
+	FScriptablePropertyBindings::FResolveScope Scope;
+	Scope.TargetView = FPropertyBindingDataView(TargetObject);
+	Scope.ContextView = MakeContextView(TargetObject->GetContext());
+	Scope.ContextVersion = TargetObject->GetContextVersion();
+	Scope.Object = TargetObject;
+	return Scope;
+}
+
+/** Scope of the bindings of a struct node: its memory and the Context of its container. */
+static FScriptablePropertyBindings::FResolveScope MakeNodeScope(FStructView TargetNode, const FInstancedPropertyBag* Context, const FScriptableDataVersion* ContextVersion)
+{
+	FScriptablePropertyBindings::FResolveScope Scope;
+	Scope.TargetView = FPropertyBindingDataView(TargetNode.GetScriptStruct(), TargetNode.GetMemory());
+	Scope.ContextView = MakeContextView(Context);
+	Scope.ContextVersion = ContextVersion;
+	return Scope;
+}
+
+void FScriptablePropertyBindings::CompileBindings(UScriptableObject* TargetObject)
+{
+	if (!TargetObject) return;
+
+	CompileBindingsInternal(MakeObjectScope(TargetObject));
+}
+
+void FScriptablePropertyBindings::CompileBindings(FStructView TargetNode, const FInstancedPropertyBag* Context)
+{
+	if (!TargetNode.IsValid()) return;
+
+	CompileBindingsInternal(MakeNodeScope(TargetNode, Context, nullptr));
+}
+
+void FScriptablePropertyBindings::CompileBindingsInternal(const FResolveScope& Scope)
+{
+	if (CompiledBindings.Num() != Bindings.Num())
+	{
+		ResetCompiledBindings();
+		CompiledBindings.SetNum(Bindings.Num());
+	}
+
+	for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+	{
+		const FScriptablePropertyBinding& Binding = Bindings[Index];
+		FScriptableCompiledBinding& Compiled = CompiledBindings[Index];
+
+		EnsureCompiled(Compiled.Target, Binding.TargetPath, Scope.TargetView);
+
+		// Registration may have changed the sibling behind the ID, look it up again
+		Compiled.SourceObject.Reset();
+
+		// Sources that are not registered yet will be compiled on first resolve
+		const FPropertyBindingDataView SourceView = GetSourceView(Binding, Compiled, Scope);
+		if (SourceView.IsValid())
+		{
+			EnsureCompiled(Compiled.Source, Binding.SourcePath, SourceView);
+		}
+
+		if (Compiled.Source.LeafProperty && Compiled.Target.LeafProperty)
+		{
+			SelectConversion(Compiled, Scope.TargetView);
+		}
+	}
+
+	BuildCopySpans();
+}
+
+void FScriptablePropertyBindings::ResolveBindings(UScriptableObject* TargetObject)
+{
+	if (!TargetObject) return;
+
+	ResolveBindingsInternal(MakeObjectScope(TargetObject), false);
+}
+
+void FScriptablePropertyBindings::ResolveTickBindings(UScriptableObject* TargetObject)
+{
+	if (!TargetObject) return;
+
+	ResolveBindingsInternal(MakeObjectScope(TargetObject), true);
+}
+
+void FScriptablePropertyBindings::ResolveBindings(FStructView TargetNode, const FInstancedPropertyBag* Context, const FScriptableDataVersion* ContextVersion)
+{
+	if (!TargetNode.IsValid() || Bindings.IsEmpty()) return;
+
+	ResolveBindingsInternal(MakeNodeScope(TargetNode, Context, ContextVersion), false);
+}
+
+bool FScriptablePropertyBindings::HasTickBindings() const
+{
+	return Bindings.ContainsByPredicate([](const FScriptablePropertyBinding& Binding) { return Binding.ResolvesOnTick(); });
+}
+
+void FScriptablePropertyBindings::ResolveBindingsInternal(const FResolveScope& Scope, bool bTickOnly)
+{
+	if (CompiledBindings.Num() != Bindings.Num())
+	{
+		ResetCompiledBindings();
+		CompiledBindings.SetNum(Bindings.Num());
+	}
+
+	// The Target View is always the object (or node) requesting the resolution
+	const FPropertyBindingDataView& TargetView = Scope.TargetView;
+
+	for (int32 Index = 0; Index < Bindings.Num(); ++Index)
+	{
+		const FScriptablePropertyBinding& Binding = Bindings[Index];
+		FScriptableCompiledBinding& Compiled = CompiledBindings[Index];
+
+		if (bTickOnly && !Binding.ResolvesOnTick())
+		{
+			continue;
+		}
+
+		// Span members are copied along with the head of their span
+		if (Compiled.SpanIndex != INDEX_NONE && !Compiled.bSpanHead)
+		{
+			continue;
+		}
+
+		// Determine the Source Data View (Who are we copying FROM?)
+		uint64 SourceVersion = 0;
+		const FPropertyBindingDataView SourceView = GetSourceView(Binding, Compiled, Scope, &SourceVersion);
+
+		if (!SourceView.IsValid())
+		{
+			continue;
+		}
+
+		// Only OnChange bindings skip unchanged sources, and only before ticks. Begin and CheckCondition always copy,
+		// as the target or an unmarked Context may have been written since.
+		if (!bTickOnly || Binding.ResolvePolicy != EScriptableBindingResolvePolicy::OnChange)
+		{
+			SourceVersion = 0;
+		}
+
+		if (Compiled.SpanIndex != INDEX_NONE)
+		{
+			if (CopySpan(CopySpans[Compiled.SpanIndex], SourceView, TargetView, SourceVersion))
 			{
-				// Source object not found (e.g., was deleted or not loaded yet). Skip binding.
 				continue;
 			}
+
+			// The source layout changed, the remaining members (all after the head) are copied one by one
+			ResetCopySpans();
 		}
-		else
+
+		// Perform the Copy
+		CopyBinding(Binding, Compiled, SourceView, TargetView, SourceVersion);
+	}
+}
+
+void FScriptablePropertyBindings::ReleaseReferences(UScriptableObject* TargetObject)
+{
+	if (!TargetObject) return;
+
+	ReleaseReferencesInternal(FPropertyBindingDataView(TargetObject));
+}
+
+void FScriptablePropertyBindings::ReleaseReferences(FStructView TargetNode)
+{
+	if (!TargetNode.IsValid()) return;
+
+	ReleaseReferencesInternal(FPropertyBindingDataView(TargetNode.GetScriptStruct(), TargetNode.GetMemory()));
+}
+
+void FScriptablePropertyBindings::ReleaseReferencesInternal(const FPropertyBindingDataView& TargetView)
+{
+	for (int32 Index = 0; Index < CompiledBindings.Num(); ++Index)
+	{
+		FScriptableCompiledBinding& Compiled = CompiledBindings[Index];
+		if (Compiled.Conversion.Kind != EScriptableBindingConversion::Reference)
 		{
-			// CASE B: Context Binding
-			SourceView = ContextView;
+			continue;
 		}
 
-		// Perform the Copy
-		if (SourceView.IsValid())
+		// References are plain struct paths inside the target object, no getters are called
+		FScriptableBindingScratch& Scratch = FScriptableBindingScratch::Get();
+		FScriptableBindingScratch::FScope ScratchScope;
+
+		if (void* TargetAddr = WalkPlan(Compiled.Target, Bindings[Index].TargetPath, TargetView, Scratch))
 		{
-			CopySingleBinding(Binding, SourceView, TargetView);
+			static_cast<FScriptablePropertyRef*>(TargetAddr)->Reset();
 		}
+
+		// Point to the source again on the next resolve, even if it did not change
+		Compiled.CopiedVersion = 0;
 	}
 }
 
-void FScriptablePropertyBindings::CopySingleBinding(const FScriptablePropertyBinding& Binding, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView)
+void FScriptablePropertyBindings::CopyBinding(const FScriptablePropertyBinding& Binding, FScriptableCompiledBinding& Compiled, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView, uint64 SourceVersion)
 {
-	const FProperty* SourceProp = nullptr;
-	void* SourceAddr = nullptr;
-	TArray<TSharedPtr<FStructOnScope>> TempMemoryArray;
+	// Both plans are compiled once per layout, this only does name lookups on the first copy
+	if (!EnsureCompiled(Compiled.Source, Binding.SourcePath, SrcView)) return;
+	if (!EnsureCompiled(Compiled.Target, Binding.TargetPath, DestView)) return;
 
-	// Path resolution for the Source (Executes functions natively mid-path)
-	if (!ResolveIndirections(Binding.SourcePath, SrcView, SourceProp, SourceAddr, TempMemoryArray)) return;
+	// Versions only cover the source memory itself. Paths through other objects or getters can change at any time.
+	const bool bVersioned = SourceVersion != 0 && Compiled.Source.bOwnedMemoryOnly && Compiled.Target.bOwnedMemoryOnly;
+	if (bVersioned && Compiled.CopiedVersion == SourceVersion)
+	{
+		// Nothing was written to the source since the last copy
+		return;
+	}
+
+	// Getter return values live in reusable per-thread frames until the copy is done
+	FScriptableBindingScratch& Scratch = FScriptableBindingScratch::Get();
+	FScriptableBindingScratch::FScope ScratchScope;
 
-	const FProperty* TargetProp = nullptr;
-	void* TargetAddr = nullptr;
-	TArray<TSharedPtr<FStructOnScope>> TargetTempMemoryArray; // Targets shouldn't have functions, but required by signature
+	// Path resolution for the Source (Executes functions natively mid-path)
+	void* SourceAddr = WalkPlan(Compiled.Source, Binding.SourcePath, SrcView, Scratch);
+	if (!SourceAddr) return;
 
 	// Path resolution for the Target
-	if (!ResolveIndirections(Binding.TargetPath, DestView, TargetProp, TargetAddr, TargetTempMemoryArray)) return;
+	void* TargetAddr = WalkPlan(Compiled.Target, Binding.TargetPath, DestView, Scratch);
+	if (!TargetAddr) return;
 
-	if (SourceProp && TargetProp && SourceAddr && TargetAddr)
+	const FProperty* SourceProp = Compiled.Source.LeafProperty;
+	const FProperty* TargetProp = Compiled.Target.LeafProperty;
+
+	if (SourceProp && TargetProp)
 	{
-		// Identical Types (Fast Copy)
-		if (SourceProp->SameType(TargetProp))
+		// The conversion only changes if a plan was recompiled against a different leaf
+		if (!Compiled.Conversion.IsSelectedFor(SourceProp, TargetProp))
 		{
-			SourceProp->CopyCompleteValue(TargetAddr, SourceAddr);
+			SelectConversion(Compiled, DestView);
 		}
-		else
+
+		Compiled.Conversion.Execute(SourceAddr, TargetAddr);
+		Compiled.CopiedVersion = bVersioned ? SourceVersion : 0;
+	}
+}
+
+void FScriptablePropertyBindings::BuildCopySpans()
+{
+	ResetCopySpans();
+
+	if (!GScriptableCoalesceBindingSpans)
+	{
+		return;
+	}
+
+	struct FCandidate
+	{
+		int32 BindingIndex;
+		int32 SourceOffset;
+		int32 TargetOffset;
+		int32 Size;
+	};
+
+	// Only raw copies at a fixed offset in both ends can be merged
+	TArray<FCandidate, TInlineAllocator<16>> Candidates;
+	for (int32 Index = 0; Index < CompiledBindings.Num(); ++Index)
+	{
+		const FScriptableCompiledBinding& Compiled = CompiledBindings[Index];
+		if (Compiled.Conversion.Kind != EScriptableBindingConversion::Memcpy || !Compiled.Source.RootStruct.Get())
 		{
-			// Object Reference Handling (TObjectPtr <-> Raw Ptr, Child -> Parent)
-			if (const FObjectPropertyBase* SrcObjProp = CastField<FObjectPropertyBase>(SourceProp))
-			{
-				// TObjectPtr <-> Raw Ptr
-				if (const FObjectPropertyBase* TgtObjProp = CastField<FObjectPropertyBase>(TargetProp))
-				{
-					// This gets the UObject* regardless of whether it's stored as TObjectPtr or raw pointer
-					UObject* SourceObject = SrcObjProp->GetObjectPropertyValue(SourceAddr);
+			continue;
+		}
 
-					if (!SourceObject || SourceObject->IsA(TgtObjProp->PropertyClass))
-					{
-						TgtObjProp->SetObjectPropertyValue(TargetAddr, SourceObject);
-					}
-				}
-				// Object -> Bool
-				else if (const FBoolProperty* TgtBool = CastField<FBoolProperty>(TargetProp))
-				{
-					// Get the pointer (works for TObjectPtr and raw pointers)
-					const UObject* SourceObject = SrcObjProp->GetObjectPropertyValue(SourceAddr);
+		int32 SourceOffset = 0;
+		int32 TargetOffset = 0;
+		if (Compiled.Source.GetStaticOffset(SourceOffset) && Compiled.Target.GetStaticOffset(TargetOffset))
+		{
+			Candidates.Add({ Index, SourceOffset, TargetOffset, Compiled.Conversion.Size });
+		}
+	}
 
-					// True if not null, False if null
-					TgtBool->SetPropertyValue(TargetAddr, SourceObject != nullptr);
-				}
+	if (Candidates.Num() < 2)
+	{
+		return;
+	}
+
+	// Group by source and resolve policy, then follow the source memory
+	Candidates.Sort([this](const FCandidate& A, const FCandidate& B)
+		{
+			const FScriptablePropertyBinding& BindingA = Bindings[A.BindingIndex];
+			const FScriptablePropertyBinding& BindingB = Bindings[B.BindingIndex];
+
+			if (BindingA.SourceID != BindingB.SourceID) return BindingA.SourceID < BindingB.SourceID;
+			if (BindingA.ResolvePolicy != BindingB.ResolvePolicy) return BindingA.ResolvePolicy < BindingB.ResolvePolicy;
+			return A.SourceOffset < B.SourceOffset;
+		});
+
+	int32 RunStart = 0;
+	for (int32 i = 1; i <= Candidates.Num(); ++i)
+	{
+		if (i < Candidates.Num())
+		{
+			const FCandidate& Prev = Candidates[i - 1];
+			const FCandidate& Next = Candidates[i];
+
+			const FScriptablePropertyBinding& PrevBinding = Bindings[Prev.BindingIndex];
+			const FScriptablePropertyBinding& NextBinding = Bindings[Next.BindingIndex];
+
+			const bool bSameSource = PrevBinding.SourceID == NextBinding.SourceID && PrevBinding.ResolvePolicy == NextBinding.ResolvePolicy;
+			const bool bContiguous = Next.SourceOffset == Prev.SourceOffset + Prev.Size && Next.TargetOffset == Prev.TargetOffset + Prev.Size;
+
+			if (bSameSource && bContiguous)
+			{
+				continue;
 			}
-			// Numeric <-> Numeric Conversion
-			else if (SourceProp->IsA<FNumericProperty>() && TargetProp->IsA<FNumericProperty>())
+		}
+
+		if (i - RunStart >= 2)
+		{
+			const FCandidate& First = Candidates[RunStart];
+			const FCandidate& Last = Candidates[i - 1];
+
+			const int32 SpanIndex = CopySpans.AddDefaulted();
+			FScriptableBindingCopySpan& Span = CopySpans[SpanIndex];
+			Span.SourceStruct = CompiledBindings[First.BindingIndex].Source.RootStruct;
+			Span.SourceOffset = First.SourceOffset;
+			Span.TargetOffset = First.TargetOffset;
+			Span.Size = Last.SourceOffset + Last.Size - First.SourceOffset;
+
+			// The span is copied at the position of its first binding, to keep the resolve order
+			int32 HeadIndex = MAX_int32;
+			for (int32 j = RunStart; j < i; ++j)
 			{
-				const FNumericProperty* SrcNum = CastField<FNumericProperty>(SourceProp);
-				const FNumericProperty* TgtNum = CastField<FNumericProperty>(TargetProp);
+				CompiledBindings[Candidates[j].BindingIndex].SpanIndex = SpanIndex;
+				HeadIndex = FMath::Min(HeadIndex, Candidates[j].BindingIndex);
+			}
+			CompiledBindings[HeadIndex].bSpanHead = true;
+		}
 
-				if (SrcNum->IsFloatingPoint())
-				{
-					const double Val = SrcNum->GetFloatingPointPropertyValue(SourceAddr);
-					if (TgtNum->IsFloatingPoint()) TgtNum->SetFloatingPointPropertyValue(TargetAddr, Val);
-					else TgtNum->SetIntPropertyValue(TargetAddr, (int64)Val);
-				}
-				else
+		RunStart = i;
+	}
+}
+
+void FScriptablePropertyBindings::ResetCopySpans()
+{
+	CopySpans.Reset();
+
+	for (FScriptableCompiledBinding& Compiled : CompiledBindings)
+	{
+		Compiled.SpanIndex = INDEX_NONE;
+		Compiled.bSpanHead = false;
+	}
+}
+
+bool FScriptablePropertyBindings::CopySpan(FScriptableBindingCopySpan& Span, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView, uint64 SourceVersion)
+{
+	const uint8* SourceMemory = static_cast<const uint8*>(SrcView.GetMemory());
+	uint8* TargetMemory = static_cast<uint8*>(DestView.GetMutableMemory());
+
+	if (!SourceMemory || !TargetMemory || SrcView.GetStruct() != Span.SourceStruct.Get())
+	{
+		return false;
+	}
+
+	// Span members only read owned memory, so the source version covers all of them
+	if (SourceVersion != 0 && Span.CopiedVersion == SourceVersion)
+	{
+		return true;
+	}
+
+	FMemory::Memcpy(TargetMemory + Span.TargetOffset, SourceMemory + Span.SourceOffset, Span.Size);
+	Span.CopiedVersion = SourceVersion;
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Micro-benchmark of a getter binding resolved through the cached native thunk versus ProcessEvent.
+ * Uses AActor::K2_GetActorLocation on the actor CDO so it can run without a world.
+ * Usage: Scriptable.Bench.GetterBindings [Iterations]
+ */
+static void BenchmarkGetterBindings(const TArray<FString>& Args)
+{
+	const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000000;
+
+	AActor* Actor = GetMutableDefault<AActor>();
+	const FPropertyBindingDataView View(Actor);
+
+	FPropertyBindingPath Path;
+	Path.AddPathSegment(GET_FUNCTION_NAME_CHECKED(AActor, K2_GetActorLocation));
+
+	FScriptableBindingPathPlan NativePlan;
+	if (NativePlan.Compile(Path, View) != EScriptableBindingCompileResult::Compiled || !NativePlan.Segments[0].NativeGetter)
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("Scriptable.Bench.GetterBindings: K2_GetActorLocation did not compile to a native getter."));
+		return;
+	}
+
+	// Same plan with the fast path disabled, as Blueprint getters are resolved
+	FScriptableBindingPathPlan ProcessEventPlan = NativePlan;
+	ProcessEventPlan.Segments[0].NativeGetter = nullptr;
+
+	FScriptableBindingScratch& Scratch = FScriptableBindingScratch::Get();
+
+	auto Run = [&](const FScriptableBindingPathPlan& Plan)
+		{
+			FVector Sum = FVector::ZeroVector;
+			bool bStale = false;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Iterations; ++i)
+			{
+				FScriptableBindingScratch::FScope ScratchScope;
+				if (const FVector* Value = static_cast<const FVector*>(Plan.Walk(Actor, Scratch, bStale)))
 				{
-					const int64 Val = SrcNum->GetSignedIntPropertyValue(SourceAddr);
-					if (TgtNum->IsFloatingPoint()) TgtNum->SetFloatingPointPropertyValue(TargetAddr, (double)Val);
-					else TgtNum->SetIntPropertyValue(TargetAddr, Val);
+					Sum += *Value;
 				}
 			}
-			// Bool -> Numeric (True=1, False=0)
-			else if (const FBoolProperty* SrcBool = CastField<FBoolProperty>(SourceProp))
+			const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			// Keeps the loop from being optimized away
+			check(!Sum.ContainsNaN());
+			return Ms;
+		};
+
+	const double ProcessEventMs = Run(ProcessEventPlan);
+	const double NativeMs = Run(NativePlan);
+
+	UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Bench.GetterBindings (%d iterations): ProcessEvent %.3f ms (%.1f ns/call), native thunk %.3f ms (%.1f ns/call), speedup x%.2f"),
+		Iterations,
+		ProcessEventMs, ProcessEventMs * 1.0e6 / Iterations,
+		NativeMs, NativeMs * 1.0e6 / Iterations,
+		NativeMs > 0.0 ? ProcessEventMs / NativeMs : 0.0);
+}
+
+static FAutoConsoleCommand BenchmarkGetterBindingsCommand(
+	TEXT("Scriptable.Bench.GetterBindings"),
+	TEXT("Compares getter bindings resolved through the cached native thunk against ProcessEvent. Usage: Scriptable.Bench.GetterBindings [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkGetterBindings));
+
+#if WITH_EDITOR
+/**
+ * Benchmark of coalesced copy spans against copying each binding separately.
+ * Binds A and B of a battery of UScriptableCondition_CompareNumbers to two adjacent doubles of a context bag.
+ * Usage: Scriptable.Bench.CoalescedBindings [NumConditions] [Iterations]
+ */
+static void BenchmarkCoalescedBindings(const TArray<FString>& Args)
+{
+	const int32 NumConditions = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+	const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 1000;
+
+	FInstancedPropertyBag Context;
+	Context.AddProperty(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A), EPropertyBagPropertyType::Double);
+	Context.AddProperty(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B), EPropertyBagPropertyType::Double);
+	Context.SetValueDouble(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A), 1.0);
+	Context.SetValueDouble(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B), 2.0);
+
+	TArray<TStrongObjectPtr<UScriptableCondition_CompareNumbers>> Conditions;
+	Conditions.Reserve(NumConditions);
+
+	for (int32 i = 0; i < NumConditions; ++i)
+	{
+		UScriptableCondition_CompareNumbers* Condition = NewObject<UScriptableCondition_CompareNumbers>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		for (const FName Name : { GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A), GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B) })
+		{
+			FPropertyBindingPath Path;
+			Path.AddPathSegment(Name);
+			Condition->GetPropertyBindings().AddPropertyBinding(Path, Path);
+		}
+
+		// No context version, so every resolve copies
+		Condition->InitRuntimeData(&Context, nullptr);
+		Conditions.Emplace(Condition);
+	}
+
+	auto Run = [&](bool bCoalesce)
+		{
+			const bool bWasCoalescing = GScriptableCoalesceBindingSpans;
+			GScriptableCoalesceBindingSpans = bCoalesce;
+			for (const TStrongObjectPtr<UScriptableCondition_CompareNumbers>& Condition : Conditions)
 			{
-				if (const FNumericProperty* TgtNum = CastField<FNumericProperty>(TargetProp))
-				{
-					const bool bVal = SrcBool->GetPropertyValue(SourceAddr);
-					if (TgtNum->IsFloatingPoint()) TgtNum->SetFloatingPointPropertyValue(TargetAddr, bVal ? 1.0 : 0.0);
-					else TgtNum->SetIntPropertyValue(TargetAddr, int64(bVal ? 1 : 0));
-				}
+				Condition->GetPropertyBindings().ResetCompiledBindings();
+				Condition->CompileBindings();
 			}
-			// Numeric -> Bool (0=False, !=0 True)
-			else if (const FNumericProperty* SrcNum = CastField<FNumericProperty>(SourceProp))
+			GScriptableCoalesceBindingSpans = bWasCoalescing;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
 			{
-				if (const FBoolProperty* TgtBool = CastField<FBoolProperty>(TargetProp))
+				for (const TStrongObjectPtr<UScriptableCondition_CompareNumbers>& Condition : Conditions)
 				{
-					bool bResult = false;
-					if (SrcNum->IsFloatingPoint()) bResult = !FMath::IsNearlyZero(SrcNum->GetFloatingPointPropertyValue(SourceAddr));
-					else bResult = (SrcNum->GetSignedIntPropertyValue(SourceAddr) != 0);
-
-					TgtBool->SetPropertyValue(TargetAddr, bResult);
+					Condition->ResolveBindings();
 				}
 			}
-		}
+			return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		};
+
+	const double SeparateMs = Run(false);
+	const double CoalescedMs = Run(true);
+	const double NumResolves = double(NumConditions) * Iterations;
+
+	UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Bench.CoalescedBindings (%d conditions x %d iterations): separate %.3f ms (%.1f ns/resolve), coalesced %.3f ms (%.1f ns/resolve), speedup x%.2f"),
+		NumConditions, Iterations,
+		SeparateMs, SeparateMs * 1.0e6 / NumResolves,
+		CoalescedMs, CoalescedMs * 1.0e6 / NumResolves,
+		CoalescedMs > 0.0 ? SeparateMs / CoalescedMs : 0.0);
+
+	for (const TStrongObjectPtr<UScriptableCondition_CompareNumbers>& Condition : Conditions)
+	{
+		Condition->InitRuntimeData(nullptr, nullptr);
 	}
-}
\ No newline at end of file
+}
+
+static FAutoConsoleCommand BenchmarkCoalescedBindingsCommand(
+	TEXT("Scriptable.Bench.CoalescedBindings"),
+	TEXT("Compares contiguous POD bindings copied as a single memcpy span against copying each binding. Usage: Scriptable.Bench.CoalescedBindings [NumConditions] [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkCoalescedBindings));
+#endif // WITH_EDITOR
+#endif
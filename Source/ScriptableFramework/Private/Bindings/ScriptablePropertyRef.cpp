@@ -0,0 +1,80 @@
+// Copyright 2026 kirzo
+
+#include "Bindings/ScriptablePropertyRef.h"
+#include "UObject/UnrealType.h"
+
+namespace ScriptablePropertyRef
+{
+	/** Returns the C++ type of the property without spaces, with TObjectPtr<X> written as X*. */
+	static FString GetNormalizedTypeName(FString Type)
+	{
+		Type.ReplaceInline(TEXT(" "), TEXT(""));
+
+		static const FString ObjectPtrPrefix = TEXT("TObjectPtr<");
+
+		int32 Start = Type.Find(ObjectPtrPrefix, ESearchCase::CaseSensitive);
+		while (Start != INDEX_NONE)
+		{
+			// Find the matching closing bracket
+			int32 Depth = 0;
+			int32 End = INDEX_NONE;
+			for (int32 Index = Start + ObjectPtrPrefix.Len() - 1; Index < Type.Len(); ++Index)
+			{
+				if (Type[Index] == TEXT('<'))
+				{
+					++Depth;
+				}
+				else if (Type[Index] == TEXT('>') && --Depth == 0)
+				{
+					End = Index;
+					break;
+				}
+			}
+
+			if (End == INDEX_NONE)
+			{
+				break;
+			}
+
+			const int32 InnerStart = Start + ObjectPtrPrefix.Len();
+			Type = Type.Left(Start) + Type.Mid(InnerStart, End - InnerStart) + TEXT("*") + Type.Mid(End + 1);
+			Start = Type.Find(ObjectPtrPrefix, ESearchCase::CaseSensitive);
+		}
+
+		return Type;
+	}
+}
+
+bool FScriptablePropertyRef::IsRefProperty(const FProperty* Property)
+{
+	const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+	return StructProperty && StructProperty->Struct == StaticStruct();
+}
+
+bool FScriptablePropertyRef::CanReference(const FProperty* RefProperty, const FProperty* SourceProperty)
+{
+	if (!IsRefProperty(RefProperty) || !SourceProperty)
+	{
+		return false;
+	}
+
+	// References to references would dangle as soon as the source is resolved again
+	if (IsRefProperty(SourceProperty))
+	{
+		return false;
+	}
+
+#if WITH_METADATA
+	static const FName RefTypeMetaName = TEXT("RefType");
+
+	const FString& RefType = RefProperty->GetMetaData(RefTypeMetaName);
+	if (!RefType.IsEmpty())
+	{
+		FString ExtendedType;
+		const FString SourceType = SourceProperty->GetCPPType(&ExtendedType) + ExtendedType;
+		return ScriptablePropertyRef::GetNormalizedTypeName(SourceType) == ScriptablePropertyRef::GetNormalizedTypeName(RefType);
+	}
+#endif
+
+	return true;
+}
@@ -124,6 +124,8 @@ static void AssignContextParameterToContainer(FFrame& Stack, const UScriptStruct
 				// --- Standard Assignment for other types (Primitives, Structs, Arrays) ---
 				BagProp->CopyCompleteValue(DestPtr, ValuePtr);
 			}
+
+			Container->MarkContextChanged();
 		}
 	}
 
@@ -6,5 +6,54 @@ bool UScriptableCondition::CheckCondition()
 {
 	ResolveBindings();
 	const bool bResult = Evaluate();
+	MarkOutputsChanged();
 	return IsNegated() ? !bResult : bResult;
+}
+
+bool UScriptableCondition::CheckSnapshot() const
+{
+	// Straight to the native implementation, Blueprint events can't run off the game thread
+	const bool bResult = Evaluate_Implementation();
+	return IsNegated() ? !bResult : bResult;
+}
+
+bool UScriptableCondition::DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const
+{
+	if (!bNotifiesChanges)
+	{
+		return false;
+	}
+
+	Sources.AddCustom([WeakThis = TWeakObjectPtr<const UScriptableCondition>(this)](const FSimpleDelegate& OnInvalidated) -> TFunction<void()>
+		{
+			const FDelegateHandle Handle = WeakThis->OnResultChanged.Add(OnInvalidated);
+			return [WeakThis, Handle]()
+				{
+					if (const UScriptableCondition* Condition = WeakThis.Get())
+					{
+						Condition->OnResultChanged.Remove(Handle);
+					}
+				};
+		});
+
+	return DeclareBoundContextProperties(Sources);
+}
+
+bool UScriptableCondition::DeclareBoundContextProperties(FScriptableInvalidationSources& Sources) const
+{
+	bool bComplete = true;
+
+	for (const FScriptablePropertyBinding& Binding : GetPropertyBindings().Bindings)
+	{
+		// Sibling outputs change whenever the sibling runs, values inside a Context object change without the Context
+		if (Binding.SourceID.IsValid() || Binding.SourcePath.NumSegments() != 1 || !GetContext())
+		{
+			bComplete = false;
+			continue;
+		}
+
+		Sources.AddContextProperty(*GetContext(), Binding.SourcePath.GetSegment(0).GetName());
+	}
+
+	return bComplete;
 }
\ No newline at end of file
@@ -0,0 +1,333 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptableConditionKernels.h"
+#include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "Templates/IntegralConstant.h"
+
+#if !UE_BUILD_SHIPPING
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "ScriptableObject.h"
+#endif
+
+namespace ScriptableConditionKernels
+{
+	/** Rows packed in one word of a TBitArray. */
+	static constexpr int32 RowsPerWord = NumBitsPerDWORD;
+
+	/** Rows compared per vector register. */
+	static constexpr int32 RowsPerVector = 4;
+
+	/** Tolerance UScriptableCondition_Distance uses for == and !=. */
+	static constexpr double DistanceTolerance = 1.e-4;
+
+	/** Compares four rows, returns one bit per row (lane 0 in bit 0). */
+	template<EScriptableComparisonOp Op>
+	static FORCEINLINE uint32 CompareVector(const VectorRegister4Double& A, const VectorRegister4Double& B, const VectorRegister4Double& Tolerance)
+	{
+		if constexpr (Op == EScriptableComparisonOp::Equal)
+		{
+			return VectorMaskBits(VectorCompareLE(VectorAbs(VectorSubtract(A, B)), Tolerance));
+		}
+		else if constexpr (Op == EScriptableComparisonOp::NotEqual)
+		{
+			// Inverted rather than compared with >, so NaNs are not equal, as with FMath::IsNearlyEqual
+			return VectorMaskBits(VectorCompareLE(VectorAbs(VectorSubtract(A, B)), Tolerance)) ^ 0xF;
+		}
+		else if constexpr (Op == EScriptableComparisonOp::Less)
+		{
+			return VectorMaskBits(VectorCompareLT(A, B));
+		}
+		else if constexpr (Op == EScriptableComparisonOp::LessOrEqual)
+		{
+			return VectorMaskBits(VectorCompareLE(A, B));
+		}
+		else if constexpr (Op == EScriptableComparisonOp::Greater)
+		{
+			return VectorMaskBits(VectorCompareGT(A, B));
+		}
+		else
+		{
+			return VectorMaskBits(VectorCompareGE(A, B));
+		}
+	}
+
+	static FORCEINLINE bool CompareScalar(EScriptableComparisonOp Operation, double A, double B, double Tolerance)
+	{
+		switch (Operation)
+		{
+			case EScriptableComparisonOp::Equal:          return FMath::IsNearlyEqual(A, B, Tolerance);
+			case EScriptableComparisonOp::NotEqual:       return !FMath::IsNearlyEqual(A, B, Tolerance);
+			case EScriptableComparisonOp::Less:           return A < B;
+			case EScriptableComparisonOp::LessOrEqual:    return A <= B;
+			case EScriptableComparisonOp::Greater:        return A > B;
+			case EScriptableComparisonOp::GreaterOrEqual: return A >= B;
+		}
+		return false;
+	}
+
+	/** Calls Kernel with the operation as a compile time constant, so the comparison is not switched per row. */
+	template<typename KernelType>
+	static void DispatchOperation(EScriptableComparisonOp Operation, KernelType&& Kernel)
+	{
+		using EOp = EScriptableComparisonOp;
+		switch (Operation)
+		{
+			case EOp::Equal:          Kernel(TIntegralConstant<EOp, EOp::Equal>()); break;
+			case EOp::NotEqual:       Kernel(TIntegralConstant<EOp, EOp::NotEqual>()); break;
+			case EOp::Less:           Kernel(TIntegralConstant<EOp, EOp::Less>()); break;
+			case EOp::LessOrEqual:    Kernel(TIntegralConstant<EOp, EOp::LessOrEqual>()); break;
+			case EOp::Greater:        Kernel(TIntegralConstant<EOp, EOp::Greater>()); break;
+			case EOp::GreaterOrEqual: Kernel(TIntegralConstant<EOp, EOp::GreaterOrEqual>()); break;
+		}
+	}
+
+	/**
+	 * Fills OutResults a whole word at a time with CompareRows (four rows starting at the given one),
+	 * then the rows that don't fill a word with CompareRow.
+	 */
+	template<typename VectorFnType, typename ScalarFnType>
+	static FORCEINLINE void WriteMask(int32 NumRows, TBitArray<>& OutResults, VectorFnType&& CompareRows, ScalarFnType&& CompareRow)
+	{
+		OutResults.Init(false, NumRows);
+
+		uint32* Words = OutResults.GetData();
+		const int32 NumFullWords = NumRows / RowsPerWord;
+
+		for (int32 Word = 0; Word < NumFullWords; ++Word)
+		{
+			const int32 FirstRow = Word * RowsPerWord;
+
+			uint32 Bits = 0;
+			for (int32 Lane = 0; Lane < RowsPerWord; Lane += RowsPerVector)
+			{
+				Bits |= CompareRows(FirstRow + Lane) << Lane;
+			}
+			Words[Word] = Bits;
+		}
+
+		for (int32 Row = NumFullWords * RowsPerWord; Row < NumRows; ++Row)
+		{
+			OutResults[Row] = CompareRow(Row);
+		}
+	}
+
+	/** A single value used for every row has a stride of 0. */
+	template<bool bColumnA, bool bColumnB>
+	static void CompareNumbersImpl(const double* A, const double* B, int32 NumRows, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults)
+	{
+		DispatchOperation(Operation, [=, &OutResults](auto OpConstant)
+			{
+				constexpr EScriptableComparisonOp Op = decltype(OpConstant)::Value;
+
+				const VectorRegister4Double ToleranceVector = VectorSetFloat1(Tolerance);
+				const VectorRegister4Double SplatA = VectorSetFloat1(*A);
+				const VectorRegister4Double SplatB = VectorSetFloat1(*B);
+
+				WriteMask(NumRows, OutResults,
+					[=](int32 Row)
+					{
+						const VectorRegister4Double ValuesA = bColumnA ? VectorLoad(A + Row) : SplatA;
+						const VectorRegister4Double ValuesB = bColumnB ? VectorLoad(B + Row) : SplatB;
+						return CompareVector<Op>(ValuesA, ValuesB, ToleranceVector);
+					},
+					[=](int32 Row)
+					{
+						return CompareScalar(Op, A[bColumnA ? Row : 0], B[bColumnB ? Row : 0], Tolerance);
+					});
+			});
+	}
+
+	template<bool bColumnOrigin>
+	static void CompareDistancesImpl(const FVector* Origins, const FVector* Targets, int32 NumRows, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults)
+	{
+		// Squared in float, as the condition does
+		const double ThresholdSq = FMath::Square(Distance);
+
+		DispatchOperation(Operation, [=, &OutResults](auto OpConstant)
+			{
+				constexpr EScriptableComparisonOp Op = decltype(OpConstant)::Value;
+
+				const VectorRegister4Double ToleranceVector = VectorSetFloat1(DistanceTolerance);
+				const VectorRegister4Double ThresholdVector = VectorSetFloat1(ThresholdSq);
+
+				WriteMask(NumRows, OutResults,
+					[=](int32 Row)
+					{
+						// Positions are stored as arrays of structures, transposed here into one register per axis
+						const FVector* T = Targets + Row;
+						const FVector* O = bColumnOrigin ? Origins + Row : Origins;
+						const int32 OS = bColumnOrigin ? 1 : 0;
+
+						const VectorRegister4Double DX = VectorSubtract(MakeVectorRegisterDouble(T[0].X, T[1].X, T[2].X, T[3].X), MakeVectorRegisterDouble(O[0].X, O[OS].X, O[2 * OS].X, O[3 * OS].X));
+						const VectorRegister4Double DY = VectorSubtract(MakeVectorRegisterDouble(T[0].Y, T[1].Y, T[2].Y, T[3].Y), MakeVectorRegisterDouble(O[0].Y, O[OS].Y, O[2 * OS].Y, O[3 * OS].Y));
+						const VectorRegister4Double DZ = VectorSubtract(MakeVectorRegisterDouble(T[0].Z, T[1].Z, T[2].Z, T[3].Z), MakeVectorRegisterDouble(O[0].Z, O[OS].Z, O[2 * OS].Z, O[3 * OS].Z));
+
+						// Same order of operations as FVector::DistSquared, and no fused multiply-add, so both paths round alike
+						const VectorRegister4Double DistanceSq = VectorAdd(VectorAdd(VectorMultiply(DX, DX), VectorMultiply(DY, DY)), VectorMultiply(DZ, DZ));
+						return CompareVector<Op>(DistanceSq, ThresholdVector, ToleranceVector);
+					},
+					[=](int32 Row)
+					{
+						return CompareScalar(Op, FVector::DistSquared(Origins[bColumnOrigin ? Row : 0], Targets[Row]), ThresholdSq, DistanceTolerance);
+					});
+			});
+	}
+
+	void CompareNumbers(TConstArrayView<double> A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults)
+	{
+		check(A.Num() == B.Num());
+		if (A.IsEmpty())
+		{
+			OutResults.Reset();
+			return;
+		}
+		CompareNumbersImpl<true, true>(A.GetData(), B.GetData(), A.Num(), Operation, Tolerance, OutResults);
+	}
+
+	void CompareNumbers(TConstArrayView<double> A, double B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults)
+	{
+		if (A.IsEmpty())
+		{
+			OutResults.Reset();
+			return;
+		}
+		CompareNumbersImpl<true, false>(A.GetData(), &B, A.Num(), Operation, Tolerance, OutResults);
+	}
+
+	void CompareNumbers(double A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults)
+	{
+		if (B.IsEmpty())
+		{
+			OutResults.Reset();
+			return;
+		}
+		CompareNumbersImpl<false, true>(&A, B.GetData(), B.Num(), Operation, Tolerance, OutResults);
+	}
+
+	void CompareDistances(TConstArrayView<FVector> Origins, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults)
+	{
+		check(Origins.Num() == Targets.Num());
+		if (Targets.IsEmpty())
+		{
+			OutResults.Reset();
+			return;
+		}
+		CompareDistancesImpl<true>(Origins.GetData(), Targets.GetData(), Targets.Num(), Operation, Distance, OutResults);
+	}
+
+	void CompareDistances(const FVector& Origin, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults)
+	{
+		if (Targets.IsEmpty())
+		{
+			OutResults.Reset();
+			return;
+		}
+		CompareDistancesImpl<false>(&Origin, Targets.GetData(), Targets.Num(), Operation, Distance, OutResults);
+	}
+
+	void CompareNumbersScalar(TConstArrayView<double> A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults)
+	{
+		check(A.Num() == B.Num());
+		OutResults.Init(false, A.Num());
+
+		for (int32 Row = 0; Row < A.Num(); ++Row)
+		{
+			OutResults[Row] = CompareScalar(Operation, A[Row], B[Row], Tolerance);
+		}
+	}
+
+	void CompareDistancesScalar(TConstArrayView<FVector> Origins, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults)
+	{
+		check(Origins.Num() == Targets.Num());
+		OutResults.Init(false, Targets.Num());
+
+		const double ThresholdSq = FMath::Square(Distance);
+		for (int32 Row = 0; Row < Targets.Num(); ++Row)
+		{
+			OutResults[Row] = CompareScalar(Operation, FVector::DistSquared(Origins[Row], Targets[Row]), ThresholdSq, DistanceTolerance);
+		}
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Benchmark of the condition kernels against their one row at a time versions, for every comparison operator,
+ * over 1k, 10k and 100k rows of random values. Also checks that both produce the same results.
+ * Usage: Scriptable.Bench.ConditionKernels [Iterations]
+ */
+static void BenchmarkConditionKernels(const TArray<FString>& Args)
+{
+	const int32 Iterations = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 100;
+
+	FRandomStream Random(1234);
+
+	for (const int32 NumRows : { 1000, 10000, 100000 })
+	{
+		TArray<double> A, B;
+		TArray<FVector> Origins, Targets;
+		A.SetNumUninitialized(NumRows);
+		B.SetNumUninitialized(NumRows);
+		Origins.SetNumUninitialized(NumRows);
+		Targets.SetNumUninitialized(NumRows);
+
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			// Some rows share values, so == and != are not always false or true
+			A[Row] = Random.RandRange(0, 100);
+			B[Row] = Random.FRandRange(0.0f, 100.0f);
+			Origins[Row] = FVector(Random.FRandRange(-1000.0f, 1000.0f), Random.FRandRange(-1000.0f, 1000.0f), 0.0);
+			Targets[Row] = FVector(Random.FRandRange(-1000.0f, 1000.0f), Random.FRandRange(-1000.0f, 1000.0f), 0.0);
+		}
+
+		auto Time = [Iterations](auto&& Kernel)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+				{
+					Kernel();
+				}
+				return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+			};
+
+		double NumbersScalarMs = 0.0, NumbersVectorMs = 0.0;
+		double DistancesScalarMs = 0.0, DistancesVectorMs = 0.0;
+		int32 Mismatches = 0;
+
+		using EOp = EScriptableComparisonOp;
+
+		TBitArray<> ScalarResults, VectorResults;
+		for (const EOp Operation : { EOp::Equal, EOp::NotEqual, EOp::Less, EOp::LessOrEqual, EOp::Greater, EOp::GreaterOrEqual })
+		{
+			NumbersScalarMs += Time([&] { ScriptableConditionKernels::CompareNumbersScalar(A, B, Operation, 1.e-4, ScalarResults); });
+			NumbersVectorMs += Time([&] { ScriptableConditionKernels::CompareNumbers(A, B, Operation, 1.e-4, VectorResults); });
+			Mismatches += ScalarResults != VectorResults;
+
+			DistancesScalarMs += Time([&] { ScriptableConditionKernels::CompareDistancesScalar(Origins, Targets, Operation, 500.0f, ScalarResults); });
+			DistancesVectorMs += Time([&] { ScriptableConditionKernels::CompareDistances(Origins, Targets, Operation, 500.0f, VectorResults); });
+			Mismatches += ScalarResults != VectorResults;
+		}
+
+		const double NumComparisons = double(NumRows) * Iterations * 6;
+
+		UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Bench.ConditionKernels (%d rows x %d iterations x 6 operators): numbers scalar %.3f ms (%.2f ns/row), vector %.3f ms (%.2f ns/row), speedup x%.2f; distances scalar %.3f ms (%.2f ns/row), vector %.3f ms (%.2f ns/row), speedup x%.2f"),
+			NumRows, Iterations,
+			NumbersScalarMs, NumbersScalarMs * 1.0e6 / NumComparisons,
+			NumbersVectorMs, NumbersVectorMs * 1.0e6 / NumComparisons,
+			NumbersVectorMs > 0.0 ? NumbersScalarMs / NumbersVectorMs : 0.0,
+			DistancesScalarMs, DistancesScalarMs * 1.0e6 / NumComparisons,
+			DistancesVectorMs, DistancesVectorMs * 1.0e6 / NumComparisons,
+			DistancesVectorMs > 0.0 ? DistancesScalarMs / DistancesVectorMs : 0.0);
+
+		if (Mismatches > 0)
+		{
+			UE_LOG(LogScriptableObject, Warning, TEXT("Scriptable.Bench.ConditionKernels: vector and scalar results differ for %d of 12 runs over %d rows."), Mismatches, NumRows);
+		}
+	}
+}
+
+static FAutoConsoleCommand BenchmarkConditionKernelsCommand(
+	TEXT("Scriptable.Bench.ConditionKernels"),
+	TEXT("Compares the vectorized number and distance condition kernels against evaluating one row at a time. Usage: Scriptable.Bench.ConditionKernels [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkConditionKernels));
+#endif
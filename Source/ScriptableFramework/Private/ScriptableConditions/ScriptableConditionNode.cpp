@@ -0,0 +1,36 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptableConditionNode.h"
+
+bool FScriptableConditionNode::CheckCondition()
+{
+	ResolveBindings();
+	const bool bResult = Evaluate();
+	return IsNegated() ? !bResult : bResult;
+}
+
+bool FScriptableConditionNode_CompareNumbers::Evaluate() const
+{
+	switch (Operation)
+	{
+		case EScriptableComparisonOp::Equal:
+		return FMath::IsNearlyEqual(A, B, ErrorTolerance);
+
+		case EScriptableComparisonOp::NotEqual:
+		return !FMath::IsNearlyEqual(A, B, ErrorTolerance);
+
+		case EScriptableComparisonOp::Less:
+		return A < B;
+
+		case EScriptableComparisonOp::LessOrEqual:
+		return A <= B;
+
+		case EScriptableComparisonOp::Greater:
+		return A > B;
+
+		case EScriptableComparisonOp::GreaterOrEqual:
+		return A >= B;
+	}
+
+	return false;
+}
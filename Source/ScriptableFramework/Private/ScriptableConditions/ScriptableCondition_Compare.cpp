@@ -1,6 +1,7 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "ScriptableConditions/ScriptableConditionKernels.h"
 #include "GameFramework/Actor.h"
 
 #if WITH_EDITOR
@@ -66,6 +67,32 @@ bool UScriptableCondition_CompareNumbers::Evaluate_Implementation() const
 	return false;
 }
 
+void UScriptableCondition_CompareNumbers::EvaluateBatch(TConstArrayView<double> ValuesA, TConstArrayView<double> ValuesB, TBitArray<>& OutResults) const
+{
+	if (!ValuesA.IsEmpty() && !ValuesB.IsEmpty())
+	{
+		ScriptableConditionKernels::CompareNumbers(ValuesA, ValuesB, Operation, ErrorTolerance, OutResults);
+	}
+	else if (!ValuesA.IsEmpty())
+	{
+		ScriptableConditionKernels::CompareNumbers(ValuesA, B, Operation, ErrorTolerance, OutResults);
+	}
+	else if (!ValuesB.IsEmpty())
+	{
+		ScriptableConditionKernels::CompareNumbers(A, ValuesB, Operation, ErrorTolerance, OutResults);
+	}
+	else
+	{
+		OutResults.Reset();
+		return;
+	}
+
+	if (IsNegated())
+	{
+		OutResults.BitwiseNOT();
+	}
+}
+
 #if WITH_EDITOR
 FText UScriptableCondition_Distance::GetDisplayTitle() const
 {
@@ -133,4 +160,26 @@ bool UScriptableCondition_Distance::Evaluate_Implementation() const
 	}
 
 	return false;
+}
+
+void UScriptableCondition_Distance::EvaluateBatch(TConstArrayView<FVector> OriginLocations, TConstArrayView<FVector> TargetLocations, TBitArray<>& OutResults) const
+{
+	if (!OriginLocations.IsEmpty())
+	{
+		ScriptableConditionKernels::CompareDistances(OriginLocations, TargetLocations, Operation, Distance, OutResults);
+	}
+	else if (Origin)
+	{
+		ScriptableConditionKernels::CompareDistances(Origin->GetActorLocation(), TargetLocations, Operation, Distance, OutResults);
+	}
+	else
+	{
+		// No origin fails, as in Evaluate
+		OutResults.Init(false, TargetLocations.Num());
+	}
+
+	if (IsNegated())
+	{
+		OutResults.BitwiseNOT();
+	}
 }
\ No newline at end of file
@@ -22,6 +22,12 @@ void UScriptableCondition_Group::OnUnregister()
 
 bool UScriptableCondition_Group::Evaluate_Implementation() const
 {
+	// Not registered while its parent is evaluated statelessly, the nested requirement follows the same path
+	if (!IsRegistered())
+	{
+		return FScriptableRequirement::EvaluateStateless(const_cast<UScriptableCondition_Group*>(this), Requirement);
+	}
+
 	return Requirement.Evaluate();
 }
 
@@ -1,6 +1,7 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableConditions/ScriptableCondition_Logic.h"
+#include "GameFramework/Actor.h"
 
 // ------------------------------------------------------------------------------------------------
 // Compare Booleans
@@ -124,4 +125,18 @@ FText UScriptableCondition_IsValid::GetDisplayTitle() const
 bool UScriptableCondition_IsValid::Evaluate_Implementation() const
 {
 	return IsValid(TargetObject);
+}
+
+bool UScriptableCondition_IsValid::DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const
+{
+	const bool bComplete = DeclareBoundContextProperties(Sources);
+
+	if (AActor* Actor = Cast<AActor>(TargetObject))
+	{
+		Sources.AddActorDestroyed(Actor);
+		return bComplete;
+	}
+
+	// Other objects can be destroyed without notice
+	return bComplete && !TargetObject;
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptableCondition_Proximity.h"
+#include "ScriptableConditions/ScriptableSpatialSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+
+int32 UScriptableCondition_ProximityBase::CountActors(int32 MaxCount) const
+{
+	if (!Origin)
+	{
+		return 0;
+	}
+
+	const UScriptableSpatialSubsystem* Subsystem = UWorld::GetSubsystem<UScriptableSpatialSubsystem>(Origin->GetWorld());
+	if (!Subsystem)
+	{
+		return 0;
+	}
+
+	return Subsystem->CountActorsInRadius(Group, Origin->GetActorLocation(), Radius, bIgnoreOrigin ? Origin.Get() : nullptr, MaxCount);
+}
+
+#if WITH_EDITOR
+FText UScriptableCondition_ProximityBase::GetQueryText() const
+{
+	auto GetPropertyText = [this](FName PropName, const FText& ValueText) -> FText
+	{
+		FString BindingName;
+		if (GetBindingDisplayText(PropName, BindingName))
+		{
+			return FText::FromString(BindingName);
+		}
+		return ValueText;
+	};
+
+	// Format: Enemy within 500 of Self
+	return FText::Format(INVTEXT("{0} within {1} of {2}"),
+											 Group.IsNone() ? INVTEXT("Actor") : FText::FromName(Group),
+											 GetPropertyText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_ProximityBase, Radius), FText::AsNumber(Radius)),
+											 GetPropertyText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_ProximityBase, Origin), Origin ? FText::FromString(Origin->GetActorLabel()) : INVTEXT("None"))
+	);
+}
+
+FText UScriptableCondition_AnyActorInRadius::GetDisplayTitle() const
+{
+	return FText::Format(INVTEXT("Any {0}"), GetQueryText());
+}
+
+FText UScriptableCondition_CountActorsInRadius::GetDisplayTitle() const
+{
+	FString OpStr;
+	switch (Operation)
+	{
+		case EScriptableComparisonOp::Equal:          OpStr = TEXT("=="); break;
+		case EScriptableComparisonOp::NotEqual:       OpStr = TEXT("!="); break;
+		case EScriptableComparisonOp::Less:           OpStr = TEXT("<"); break;
+		case EScriptableComparisonOp::LessOrEqual:    OpStr = TEXT("<="); break;
+		case EScriptableComparisonOp::Greater:        OpStr = TEXT(">"); break;
+		case EScriptableComparisonOp::GreaterOrEqual: OpStr = TEXT(">="); break;
+	}
+
+	FString CountBinding;
+	const FText CountText = GetBindingDisplayText(GET_MEMBER_NAME_CHECKED(UScriptableCondition_CountActorsInRadius, Count), CountBinding) ? FText::FromString(CountBinding) : FText::AsNumber(Count);
+
+	// Format: Count(Enemy within 500 of Self) >= 3
+	return FText::Format(INVTEXT("Count({0}) {1} {2}"), GetQueryText(), FText::FromString(OpStr), CountText);
+}
+#endif
+
+bool UScriptableCondition_AnyActorInRadius::Evaluate_Implementation() const
+{
+	return CountActors(1) > 0;
+}
+
+bool UScriptableCondition_CountActorsInRadius::Evaluate_Implementation() const
+{
+	// Every operator is decided once one actor more than Count was found
+	const int32 Actual = CountActors(Count < MAX_int32 ? Count + 1 : Count);
+
+	switch (Operation)
+	{
+		case EScriptableComparisonOp::Equal:          return Actual == Count;
+		case EScriptableComparisonOp::NotEqual:       return Actual != Count;
+		case EScriptableComparisonOp::Less:           return Actual < Count;
+		case EScriptableComparisonOp::LessOrEqual:    return Actual <= Count;
+		case EScriptableComparisonOp::Greater:        return Actual > Count;
+		case EScriptableComparisonOp::GreaterOrEqual: return Actual >= Count;
+	}
+
+	return false;
+}
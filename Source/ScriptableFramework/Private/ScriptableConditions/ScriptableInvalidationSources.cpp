@@ -0,0 +1,184 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptableInvalidationSources.h"
+#include "GameFramework/Actor.h"
+
+int32 FScriptableInvalidationSources::NumWatchedContexts = 0;
+int32 FScriptableInvalidationSources::SuspendCount = 0;
+
+namespace ScriptableInvalidationSources
+{
+	/** Instances watching each Context. */
+	static TMap<const FInstancedPropertyBag*, TArray<FScriptableInvalidationSources*, TInlineAllocator<2>>> WatchersByContext;
+}
+
+void UScriptableInvalidationListener::HandleActorDestroyed(AActor* DestroyedActor)
+{
+	OnInvalidated.ExecuteIfBound();
+}
+
+UScriptableInvalidationListener& FScriptableInvalidationSources::GetListener()
+{
+	if (!Listener)
+	{
+		Listener.Reset(NewObject<UScriptableInvalidationListener>());
+		Listener->OnInvalidated = OnInvalidated;
+	}
+	return *Listener;
+}
+
+void FScriptableInvalidationSources::SetCallback(FSimpleDelegate InOnInvalidated)
+{
+	OnInvalidated = MoveTemp(InOnInvalidated);
+	if (Listener)
+	{
+		Listener->OnInvalidated = OnInvalidated;
+	}
+}
+
+void FScriptableInvalidationSources::AddContextProperty(const FInstancedPropertyBag& Context, FName PropertyName)
+{
+	using namespace ScriptableInvalidationSources;
+
+	const UPropertyBag* Layout = Context.GetPropertyBagStruct();
+	const FProperty* Property = Layout ? Layout->FindPropertyByName(PropertyName) : nullptr;
+	if (!Property)
+	{
+		return;
+	}
+
+	TArray<FScriptableWatchedContext>& Contexts = GetListener().Contexts;
+
+	FScriptableWatchedContext* Watched = Contexts.FindByPredicate([&Context](const FScriptableWatchedContext& Item) { return Item.Context == &Context; });
+	if (!Watched)
+	{
+		Watched = &Contexts.AddDefaulted_GetRef();
+		Watched->Context = &Context;
+		Watched->Snapshot = Context;
+
+		TArray<FScriptableInvalidationSources*, TInlineAllocator<2>>& Watchers = WatchersByContext.FindOrAdd(&Context);
+		if (Watchers.IsEmpty())
+		{
+			++NumWatchedContexts;
+		}
+		Watchers.Add(this);
+	}
+
+	Watched->Properties.AddUnique(Property);
+}
+
+void FScriptableInvalidationSources::AddActorDestroyed(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actors.Contains(Actor))
+	{
+		return;
+	}
+
+	Actor->OnDestroyed.AddUniqueDynamic(&GetListener(), &UScriptableInvalidationListener::HandleActorDestroyed);
+	Actors.Add(Actor);
+}
+
+void FScriptableInvalidationSources::AddCustom(TFunctionRef<TFunction<void()>(const FSimpleDelegate&)> Subscribe)
+{
+	if (TFunction<void()> Unsubscribe = Subscribe(OnInvalidated))
+	{
+		Unsubscribers.Add(MoveTemp(Unsubscribe));
+	}
+}
+
+void FScriptableInvalidationSources::Reset()
+{
+	using namespace ScriptableInvalidationSources;
+
+	if (Listener)
+	{
+		for (const FScriptableWatchedContext& Watched : Listener->Contexts)
+		{
+			if (TArray<FScriptableInvalidationSources*, TInlineAllocator<2>>* Watchers = WatchersByContext.Find(Watched.Context))
+			{
+				Watchers->RemoveSingleSwap(this);
+				if (Watchers->IsEmpty())
+				{
+					WatchersByContext.Remove(Watched.Context);
+					--NumWatchedContexts;
+				}
+			}
+		}
+		Listener->Contexts.Reset();
+
+		for (const TWeakObjectPtr<AActor>& Actor : Actors)
+		{
+			if (AActor* LiveActor = Actor.Get())
+			{
+				LiveActor->OnDestroyed.RemoveDynamic(Listener.Get(), &UScriptableInvalidationListener::HandleActorDestroyed);
+			}
+		}
+	}
+	Actors.Reset();
+
+	for (const TFunction<void()>& Unsubscribe : Unsubscribers)
+	{
+		Unsubscribe();
+	}
+	Unsubscribers.Reset();
+}
+
+void FScriptableInvalidationSources::HandleContextChanged(const FInstancedPropertyBag& Context)
+{
+	FScriptableWatchedContext* Watched = Listener ? Listener->Contexts.FindByPredicate([&Context](const FScriptableWatchedContext& Item) { return Item.Context == &Context; }) : nullptr;
+	if (!Watched)
+	{
+		return;
+	}
+
+	bool bChanged = Context.GetPropertyBagStruct() != Watched->Snapshot.GetPropertyBagStruct();
+	if (!bChanged)
+	{
+		const uint8* Memory = Context.GetValue().GetMemory();
+		const uint8* SnapshotMemory = Watched->Snapshot.GetValue().GetMemory();
+
+		for (const FProperty* Property : Watched->Properties)
+		{
+			if (!Property->Identical(Property->ContainerPtrToValuePtr<uint8>(Memory), Property->ContainerPtrToValuePtr<uint8>(SnapshotMemory)))
+			{
+				bChanged = true;
+				break;
+			}
+		}
+	}
+
+	if (bChanged)
+	{
+		Watched->Snapshot = Context;
+
+		// Last, the callback usually rebuilds the sources
+		OnInvalidated.ExecuteIfBound();
+	}
+}
+
+void FScriptableInvalidationSources::NotifyContextChangedInternal(const FInstancedPropertyBag& Context)
+{
+	using namespace ScriptableInvalidationSources;
+
+	if (SuspendCount > 0 || !IsInGameThread())
+	{
+		return;
+	}
+
+	const TArray<FScriptableInvalidationSources*, TInlineAllocator<2>>* Watchers = WatchersByContext.Find(&Context);
+	if (!Watchers)
+	{
+		return;
+	}
+
+	// Callbacks can start or stop watching, so only the instances still watching this Context are notified
+	const TArray<FScriptableInvalidationSources*, TInlineAllocator<2>> Notified = *Watchers;
+	for (FScriptableInvalidationSources* Sources : Notified)
+	{
+		const TArray<FScriptableInvalidationSources*, TInlineAllocator<2>>* Current = WatchersByContext.Find(&Context);
+		if (Current && Current->Contains(Sources))
+		{
+			Sources->HandleContextChanged(Context);
+		}
+	}
+}
@@ -0,0 +1,672 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptablePredicateProgram.h"
+#include "ScriptableConditions/ScriptableRequirement.h"
+#include "ScriptableConditions/ScriptableCondition.h"
+#include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "ScriptableConditions/ScriptableConditionKernels.h"
+#include "ScriptableConditions/ScriptableCondition_Group.h"
+#include "ScriptableConditions/ScriptableCondition_Logic.h"
+#include "Bindings/ScriptableBindingPlan.h"
+#include "PropertyBindingDataView.h"
+#include "StructUtils/PropertyBag.h"
+#include "GameFramework/Actor.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
+#include "ScriptableContextTable.h"
+
+namespace ScriptablePredicateProgram
+{
+	/** Kind of value an operand must produce. */
+	enum class EOperandKind : uint8
+	{
+		Number,
+		Bool,
+		Object
+	};
+
+	/** Finds how to read values of the property. Returns false for types the program does not load. */
+	static bool GetLoad(const FProperty* Property, EScriptablePredicateLoad& OutLoad, EOperandKind& OutKind)
+	{
+		OutKind = EOperandKind::Number;
+
+		if (Property->IsA<FBoolProperty>()) { OutLoad = EScriptablePredicateLoad::Bool; OutKind = EOperandKind::Bool; return true; }
+		if (Property->IsA<FObjectProperty>()) { OutLoad = EScriptablePredicateLoad::Object; OutKind = EOperandKind::Object; return true; }
+		if (Property->IsA<FFloatProperty>()) { OutLoad = EScriptablePredicateLoad::Float; return true; }
+		if (Property->IsA<FDoubleProperty>()) { OutLoad = EScriptablePredicateLoad::Double; return true; }
+		if (Property->IsA<FIntProperty>()) { OutLoad = EScriptablePredicateLoad::Int32; return true; }
+		if (Property->IsA<FInt64Property>()) { OutLoad = EScriptablePredicateLoad::Int64; return true; }
+		if (Property->IsA<FByteProperty>()) { OutLoad = EScriptablePredicateLoad::UInt8; return true; }
+
+		return false;
+	}
+
+	static FORCEINLINE const uint8* GetAddress(const FScriptablePredicateOperand& Operand, const uint8* const* BaseMemory, int32 Row)
+	{
+		return BaseMemory[Operand.BaseIndex] + Operand.Offset + Row * Operand.Stride;
+	}
+
+	static FORCEINLINE bool LoadBool(const FScriptablePredicateOperand& Operand, const uint8* const* BaseMemory, int32 Row)
+	{
+		return (*GetAddress(Operand, BaseMemory, Row) & Operand.FieldMask) != 0;
+	}
+
+	static FORCEINLINE UObject* LoadObject(const FScriptablePredicateOperand& Operand, const uint8* const* BaseMemory, int32 Row)
+	{
+		return reinterpret_cast<const FObjectPtr*>(GetAddress(Operand, BaseMemory, Row))->Get();
+	}
+
+	/** Same conversions as the numeric binding kernels. */
+	static FORCEINLINE double LoadNumber(const FScriptablePredicateOperand& Operand, const uint8* const* BaseMemory, int32 Row)
+	{
+		const uint8* Address = GetAddress(Operand, BaseMemory, Row);
+		switch (Operand.Load)
+		{
+			case EScriptablePredicateLoad::Float:  return *reinterpret_cast<const float*>(Address);
+			case EScriptablePredicateLoad::Double: return *reinterpret_cast<const double*>(Address);
+			case EScriptablePredicateLoad::Int32:  return (double)*reinterpret_cast<const int32*>(Address);
+			case EScriptablePredicateLoad::Int64:  return (double)*reinterpret_cast<const int64*>(Address);
+			case EScriptablePredicateLoad::UInt8:  return (double)*Address;
+			default: break;
+		}
+		return 0.0;
+	}
+
+	template<typename T>
+	static FORCEINLINE bool Compare(EScriptableComparisonOp Operation, T A, T B, T Tolerance)
+	{
+		switch (Operation)
+		{
+			case EScriptableComparisonOp::Equal:          return FMath::IsNearlyEqual(A, B, Tolerance);
+			case EScriptableComparisonOp::NotEqual:       return !FMath::IsNearlyEqual(A, B, Tolerance);
+			case EScriptableComparisonOp::Less:           return A < B;
+			case EScriptableComparisonOp::LessOrEqual:    return A <= B;
+			case EScriptableComparisonOp::Greater:        return A > B;
+			case EScriptableComparisonOp::GreaterOrEqual: return A >= B;
+		}
+		return false;
+	}
+
+	/** Adds the source IDs of the bindings of the conditions of the requirement and its nested groups. */
+	static void GatherBoundSourceIDs(const FScriptableRequirement& Requirement, TSet<FGuid>& OutSourceIDs)
+	{
+		for (const UScriptableCondition* Condition : Requirement.Conditions)
+		{
+			if (!Condition)
+			{
+				continue;
+			}
+
+			for (const FScriptablePropertyBinding& Binding : Condition->GetPropertyBindings().Bindings)
+			{
+				OutSourceIDs.Add(Binding.SourceID);
+			}
+
+			if (const UScriptableCondition_Group* Group = Cast<UScriptableCondition_Group>(Condition))
+			{
+				GatherBoundSourceIDs(Group->Requirement, OutSourceIDs);
+			}
+		}
+	}
+}
+
+void FScriptablePredicateProgram::Reset()
+{
+	Instructions.Reset();
+	Operands.Reset();
+	Bases.Reset();
+	bCompiled = false;
+}
+
+void FScriptablePredicateProgram::Compile(const FScriptableRequirement& Requirement)
+{
+	Reset();
+
+	TSet<FGuid> BoundSourceIDs;
+	ScriptablePredicateProgram::GatherBoundSourceIDs(Requirement, BoundSourceIDs);
+
+	CompileRequirement(Requirement, false, BoundSourceIDs);
+	bCompiled = true;
+}
+
+void FScriptablePredicateProgram::CompileRequirement(const FScriptableRequirement& Requirement, bool bConditionNegated, const TSet<FGuid>& BoundSourceIDs)
+{
+	const int32 GroupIndex = Instructions.Num();
+	{
+		FScriptablePredicateInstruction& Group = Instructions.AddDefaulted_GetRef();
+		Group.Op = EScriptablePredicateOp::Group;
+		Group.Operation = static_cast<uint8>(Requirement.Mode);
+		Group.bNegate = Requirement.bNegate != bConditionNegated;
+	}
+
+	for (UScriptableCondition* Condition : Requirement.Conditions)
+	{
+		if (Condition)
+		{
+			CompileCondition(Condition, BoundSourceIDs);
+		}
+	}
+
+	Instructions[GroupIndex].End = Instructions.Num();
+}
+
+void FScriptablePredicateProgram::CompileCondition(UScriptableCondition* Condition, const TSet<FGuid>& BoundSourceIDs)
+{
+	using namespace ScriptablePredicateProgram;
+
+	// Disabled conditions are not registered, let them behave as they do when checked directly
+	const UClass* Class = Condition->GetClass();
+	if (Condition->IsRegistered())
+	{
+		// Nested groups are inlined, their own Context is just another base. Groups with condition nodes are called out.
+		if (Class == UScriptableCondition_Group::StaticClass() && static_cast<UScriptableCondition_Group*>(Condition)->Requirement.ConditionNodes.IsEmpty())
+		{
+			CompileRequirement(static_cast<UScriptableCondition_Group*>(Condition)->Requirement, Condition->IsNegated(), BoundSourceIDs);
+			return;
+		}
+
+		struct FOperandDesc
+		{
+			FName Name;
+			EOperandKind Kind;
+			const UClass* RequiredClass = nullptr;
+		};
+
+		EScriptablePredicateOp Op = EScriptablePredicateOp::CallOut;
+		uint8 Operation = 0;
+		TArray<FOperandDesc, TInlineAllocator<3>> Descs;
+
+		// Only the exact native classes, subclasses may override Evaluate
+		if (Class == UScriptableCondition_Bool::StaticClass())
+		{
+			Op = EScriptablePredicateOp::Bool;
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_Bool, bValue), EOperandKind::Bool });
+		}
+		else if (Class == UScriptableCondition_CompareNumbers::StaticClass())
+		{
+			Op = EScriptablePredicateOp::CompareNumbers;
+			Operation = static_cast<uint8>(static_cast<const UScriptableCondition_CompareNumbers*>(Condition)->Operation);
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A), EOperandKind::Number });
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B), EOperandKind::Number });
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, ErrorTolerance), EOperandKind::Number });
+		}
+		else if (Class == UScriptableCondition_CompareBooleans::StaticClass())
+		{
+			Op = EScriptablePredicateOp::CompareBooleans;
+			Operation = static_cast<uint8>(static_cast<const UScriptableCondition_CompareBooleans*>(Condition)->Operation);
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareBooleans, bA), EOperandKind::Bool });
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareBooleans, bB), EOperandKind::Bool });
+		}
+		else if (Class == UScriptableCondition_IsValid::StaticClass())
+		{
+			Op = EScriptablePredicateOp::IsValid;
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_IsValid, TargetObject), EOperandKind::Object, UObject::StaticClass() });
+		}
+		else if (Class == UScriptableCondition_Distance::StaticClass())
+		{
+			Op = EScriptablePredicateOp::Distance;
+			Operation = static_cast<uint8>(static_cast<const UScriptableCondition_Distance*>(Condition)->Operation);
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Origin), EOperandKind::Object, AActor::StaticClass() });
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Target), EOperandKind::Object, AActor::StaticClass() });
+			Descs.Add({ GET_MEMBER_NAME_CHECKED(UScriptableCondition_Distance, Distance), EOperandKind::Number });
+		}
+
+		// Any binding to something that is not an operand (e.g. the operator) needs the full CheckCondition
+		const bool bOnlyOperandBindings = !Condition->GetPropertyBindings().Bindings.ContainsByPredicate([&Descs](const FScriptablePropertyBinding& Binding)
+			{
+				return Binding.TargetPath.NumSegments() != 1 || !Descs.ContainsByPredicate([&Binding](const FOperandDesc& Desc) { return Desc.Name == Binding.TargetPath.GetSegment(0).GetName(); });
+			});
+
+		// Lowered conditions neither resolve their bindings nor bump their output version, so siblings bound to them would read stale values
+		const bool bIsBindingSource = BoundSourceIDs.Contains(Condition->GetBindingID());
+
+		if (Op != EScriptablePredicateOp::CallOut && bOnlyOperandBindings && !bIsBindingSource)
+		{
+			const int32 FirstOperand = Operands.Num();
+			bool bAllOperands = true;
+
+			for (const FOperandDesc& Desc : Descs)
+			{
+				FScriptablePredicateOperand& Operand = Operands.AddDefaulted_GetRef();
+				if (!CompileOperand(Condition, Desc.Name, static_cast<uint8>(Desc.Kind), Desc.RequiredClass, Operand))
+				{
+					bAllOperands = false;
+					break;
+				}
+			}
+
+			if (bAllOperands)
+			{
+				FScriptablePredicateInstruction& Instruction = Instructions.AddDefaulted_GetRef();
+				Instruction.Op = Op;
+				Instruction.Operation = Operation;
+				Instruction.bNegate = Condition->IsNegated();
+				Instruction.FirstOperand = FirstOperand;
+				return;
+			}
+
+			Operands.SetNum(FirstOperand);
+		}
+	}
+
+	// CheckCondition applies the negation itself
+	FScriptablePredicateInstruction& Instruction = Instructions.AddDefaulted_GetRef();
+	Instruction.Op = EScriptablePredicateOp::CallOut;
+	Instruction.Condition = Condition;
+}
+
+bool FScriptablePredicateProgram::CompileOperand(UScriptableCondition* Condition, FName PropertyName, uint8 Kind, const UClass* RequiredClass, FScriptablePredicateOperand& OutOperand)
+{
+	using namespace ScriptablePredicateProgram;
+
+	const FScriptablePropertyBinding* Binding = Condition->GetPropertyBindings().Bindings.FindByPredicate([PropertyName](const FScriptablePropertyBinding& Other)
+		{
+			return Other.TargetPath.GetSegment(0).GetName() == PropertyName && Other.TargetPath.GetSegment(0).GetArrayIndex() == INDEX_NONE;
+		});
+
+	const FProperty* Property = nullptr;
+	int32 Offset = 0;
+
+	if (!Binding)
+	{
+		// Unbound, read the value set on the condition
+		Property = Condition->GetClass()->FindPropertyByName(PropertyName);
+		if (!Property) return false;
+
+		Offset = Property->GetOffset_ForInternal();
+		OutOperand.BaseIndex = AddBase(nullptr, Condition);
+	}
+	else
+	{
+		// Only plain Context properties have a fixed address. Siblings, object hops and getters need the binding copy.
+		const FInstancedPropertyBag* Context = Condition->GetContext();
+		if (Binding->SourceID.IsValid() || !Context || !Context->IsValid())
+		{
+			return false;
+		}
+
+		const FPropertyBindingDataView ContextView(Context->GetPropertyBagStruct(), const_cast<FInstancedPropertyBag*>(Context)->GetMutableValue().GetMemory());
+
+		FScriptableBindingPathPlan Plan;
+		if (Plan.Compile(Binding->SourcePath, ContextView) != EScriptableBindingCompileResult::Compiled || !Plan.GetStaticOffset(Offset))
+		{
+			return false;
+		}
+
+		Property = Plan.LeafProperty;
+		OutOperand.BaseIndex = AddBase(Context, nullptr);
+	}
+
+	EOperandKind PropertyKind;
+	if (!GetLoad(Property, OutOperand.Load, PropertyKind) || PropertyKind != static_cast<EOperandKind>(Kind))
+	{
+		return false;
+	}
+
+	if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(Property))
+	{
+		Offset += BoolProperty->GetByteOffset();
+		OutOperand.FieldMask = BoolProperty->GetByteMask();
+	}
+	else if (const FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property))
+	{
+		// The binding copy would reject objects of another class, only lower it if it never could
+		if (!ObjectProperty->PropertyClass || !ObjectProperty->PropertyClass->IsChildOf(RequiredClass))
+		{
+			return false;
+		}
+	}
+
+	OutOperand.Offset = Offset;
+	return true;
+}
+
+int32 FScriptablePredicateProgram::AddBase(const FInstancedPropertyBag* Bag, const UObject* Object)
+{
+	const int32 Existing = Bases.IndexOfByPredicate([Bag, Object](const FBase& Base)
+		{
+			return Bag ? Base.Bag == Bag : (!Base.Bag && Base.Memory == reinterpret_cast<const uint8*>(Object));
+		});
+
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	FBase& Base = Bases.AddDefaulted_GetRef();
+	Base.Bag = Bag;
+	Base.BagStruct = Bag ? Bag->GetPropertyBagStruct() : nullptr;
+	Base.Memory = reinterpret_cast<const uint8*>(Object);
+	return Bases.Num() - 1;
+}
+
+bool FScriptablePredicateProgram::IsUpToDate() const
+{
+	if (!bCompiled)
+	{
+		return false;
+	}
+
+	for (const FBase& Base : Bases)
+	{
+		if (Base.Bag && Base.Bag->GetPropertyBagStruct() != Base.BagStruct)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int32 FScriptablePredicateProgram::NumCallOuts() const
+{
+	return Algo::CountIf(Instructions, [](const FScriptablePredicateInstruction& Instruction) { return Instruction.Op == EScriptablePredicateOp::CallOut; });
+}
+
+bool FScriptablePredicateProgram::Execute() const
+{
+	check(bCompiled);
+
+	if (Instructions.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<const uint8*, TInlineAllocator<8>> BaseMemory;
+	GetBaseMemory(BaseMemory);
+
+	int32 Index = 0;
+	return ExecuteAt(Index, BaseMemory.GetData());
+}
+
+void FScriptablePredicateProgram::GetBaseMemory(TArray<const uint8*, TInlineAllocator<8>>& OutBaseMemory) const
+{
+	// Bag memory moves when its layout is migrated, fetch it once per execution
+	OutBaseMemory.SetNumUninitialized(Bases.Num());
+	for (int32 Index = 0; Index < Bases.Num(); ++Index)
+	{
+		const FBase& Base = Bases[Index];
+		OutBaseMemory[Index] = Base.Bag ? Base.Bag->GetValue().GetMemory() : Base.Memory;
+	}
+}
+
+bool FScriptablePredicateProgram::BindContextTable(const FScriptableRequirement& Requirement, const FScriptableContextTable& Table)
+{
+	const FInstancedPropertyBag* Context = &Requirement.GetContext();
+	if (!bCompiled || Table.GetLayout() != Context->GetPropertyBagStruct())
+	{
+		return false;
+	}
+
+	const int32 ContextBase = Bases.IndexOfByPredicate([Context](const FBase& Base) { return Base.Bag == Context; });
+	if (ContextBase == INDEX_NONE)
+	{
+		// Nothing reads the Context directly
+		return true;
+	}
+
+	// One base per column, rows are reached through the operand stride
+	TArray<int32, TInlineAllocator<8>> ColumnBases;
+	ColumnBases.Init(INDEX_NONE, Table.NumColumns());
+
+	for (FScriptablePredicateOperand& Operand : Operands)
+	{
+		if (Operand.BaseIndex != ContextBase)
+		{
+			continue;
+		}
+
+		const int32 ColumnIndex = Table.FindColumnByOffset(Operand.Offset);
+		if (ColumnIndex == INDEX_NONE)
+		{
+			return false;
+		}
+
+		const FScriptableContextTable::FColumn& Column = Table.GetColumn(ColumnIndex);
+		if (ColumnBases[ColumnIndex] == INDEX_NONE)
+		{
+			FBase& Base = Bases.AddDefaulted_GetRef();
+			Base.Memory = Column.Data.GetData();
+			ColumnBases[ColumnIndex] = Bases.Num() - 1;
+		}
+
+		Operand.BaseIndex = ColumnBases[ColumnIndex];
+		Operand.Offset -= Column.Property->GetOffset_ForInternal();
+		Operand.Stride = Column.Stride;
+	}
+
+	return true;
+}
+
+void FScriptablePredicateProgram::ExecuteBatch(const FScriptableContextTable& Table, FScriptableRequirement& Requirement, TBitArray<>& OutResults) const
+{
+	check(bCompiled);
+
+	const int32 NumRows = Table.Num();
+	OutResults.Init(false, NumRows);
+
+	if (NumRows == 0 || Instructions.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<const uint8*, TInlineAllocator<8>> BaseMemory;
+	GetBaseMemory(BaseMemory);
+
+	if (ExecuteBatchVectorized(BaseMemory.GetData(), NumRows, OutResults))
+	{
+		return;
+	}
+
+	if (NumCallOuts() == 0)
+	{
+		// Chunks are a multiple of the bit array word size, so no two chunks write to the same word
+		constexpr int32 RowsPerChunk = 1024;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumRows, RowsPerChunk);
+
+		ParallelFor(NumChunks, [this, &BaseMemory, &OutResults, NumRows](int32 Chunk)
+			{
+				const int32 FirstRow = Chunk * RowsPerChunk;
+				const int32 EndRow = FMath::Min(FirstRow + RowsPerChunk, NumRows);
+
+				for (int32 Row = FirstRow; Row < EndRow; ++Row)
+				{
+					int32 Index = 0;
+					OutResults[Row] = ExecuteAt(Index, BaseMemory.GetData(), Row);
+				}
+			});
+		return;
+	}
+
+	// Called out conditions read the Context through their bindings, so each row is copied into it first
+	FInstancedPropertyBag& Context = Requirement.GetContext();
+	const FInstancedPropertyBag SavedContext = Context;
+
+	{
+		// The rows are not real changes of the Context, requirements watching it must not see them
+		FScriptableInvalidationSources::FSuspendContextScope SuspendWatchers;
+
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			Table.CopyRowTo(Row, Context.GetMutableValue().GetMemory());
+			Requirement.MarkContextChanged();
+
+			int32 Index = 0;
+			OutResults[Row] = ExecuteAt(Index, BaseMemory.GetData(), Row);
+		}
+	}
+
+	Context = SavedContext;
+	Requirement.MarkContextChanged();
+}
+
+bool FScriptablePredicateProgram::ExecuteBatchVectorized(const uint8* const* BaseMemory, int32 NumRows, TBitArray<>& OutResults) const
+{
+	using namespace ScriptablePredicateProgram;
+
+	// The root group and one condition
+	if (Instructions.Num() != 2)
+	{
+		return false;
+	}
+
+	const FScriptablePredicateInstruction& Instruction = Instructions[1];
+	const FScriptablePredicateOperand* Operand = Operands.GetData() + Instruction.FirstOperand;
+	const EScriptableComparisonOp Operation = static_cast<EScriptableComparisonOp>(Instruction.Operation);
+
+	if (Instruction.Op == EScriptablePredicateOp::CompareNumbers)
+	{
+		// Kernels read packed doubles, other numeric columns go through the scalar path
+		for (int32 i = 0; i < 2; ++i)
+		{
+			if (Operand[i].Load != EScriptablePredicateLoad::Double || (Operand[i].Stride != 0 && Operand[i].Stride != sizeof(double)))
+			{
+				return false;
+			}
+		}
+
+		if (Operand[2].Stride != 0 || (Operand[0].Stride == 0 && Operand[1].Stride == 0))
+		{
+			return false;
+		}
+
+		const double* A = reinterpret_cast<const double*>(GetAddress(Operand[0], BaseMemory, 0));
+		const double* B = reinterpret_cast<const double*>(GetAddress(Operand[1], BaseMemory, 0));
+		const double Tolerance = LoadNumber(Operand[2], BaseMemory, 0);
+
+		if (Operand[0].Stride == 0)
+		{
+			ScriptableConditionKernels::CompareNumbers(*A, MakeArrayView(B, NumRows), Operation, Tolerance, OutResults);
+		}
+		else if (Operand[1].Stride == 0)
+		{
+			ScriptableConditionKernels::CompareNumbers(MakeArrayView(A, NumRows), *B, Operation, Tolerance, OutResults);
+		}
+		else
+		{
+			ScriptableConditionKernels::CompareNumbers(MakeArrayView(A, NumRows), MakeArrayView(B, NumRows), Operation, Tolerance, OutResults);
+		}
+	}
+	else if (Instruction.Op == EScriptablePredicateOp::Distance)
+	{
+		if (Operand[2].Stride != 0)
+		{
+			return false;
+		}
+
+		// Actor locations are gathered into columns first, rows with a missing actor fail as in ExecuteAt
+		TArray<FVector> Origins, Targets;
+		Origins.SetNumUninitialized(NumRows);
+		Targets.SetNumUninitialized(NumRows);
+		TBitArray<> Valid(true, NumRows);
+
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			const AActor* Origin = static_cast<const AActor*>(LoadObject(Operand[0], BaseMemory, Row));
+			const AActor* Target = static_cast<const AActor*>(LoadObject(Operand[1], BaseMemory, Row));
+			Origins[Row] = Origin ? Origin->GetActorLocation() : FVector::ZeroVector;
+			Targets[Row] = Target ? Target->GetActorLocation() : FVector::ZeroVector;
+			Valid[Row] = Origin && Target;
+		}
+
+		const float Distance = (float)LoadNumber(Operand[2], BaseMemory, 0);
+		ScriptableConditionKernels::CompareDistances(Origins, Targets, Operation, Distance, OutResults);
+		OutResults.CombineWithBitwiseAND(Valid, EBitwiseOperatorFlags::MaintainSize);
+	}
+	else
+	{
+		return false;
+	}
+
+	if (Instructions[0].bNegate != Instruction.bNegate)
+	{
+		OutResults.BitwiseNOT();
+	}
+	return true;
+}
+
+bool FScriptablePredicateProgram::ExecuteAt(int32& InOutIndex, const uint8* const* BaseMemory, int32 Row) const
+{
+	using namespace ScriptablePredicateProgram;
+
+	const FScriptablePredicateInstruction& Instruction = Instructions[InOutIndex++];
+	const FScriptablePredicateOperand* Operand = Operands.GetData() + Instruction.FirstOperand;
+
+	bool bResult = false;
+	switch (Instruction.Op)
+	{
+		case EScriptablePredicateOp::Group:
+		{
+			// AND: Empty = True, OR: Empty = False
+			const bool bAnd = Instruction.Operation == static_cast<uint8>(EScriptableRequirementMode::And);
+			bResult = bAnd;
+
+			while (InOutIndex < Instruction.End)
+			{
+				if (ExecuteAt(InOutIndex, BaseMemory, Row) != bAnd)
+				{
+					// Short-circuit, skip the remaining children
+					bResult = !bAnd;
+					InOutIndex = Instruction.End;
+				}
+			}
+			break;
+		}
+
+		case EScriptablePredicateOp::Bool:
+		{
+			bResult = LoadBool(Operand[0], BaseMemory, Row);
+			break;
+		}
+
+		case EScriptablePredicateOp::CompareNumbers:
+		{
+			bResult = Compare<double>(static_cast<EScriptableComparisonOp>(Instruction.Operation), LoadNumber(Operand[0], BaseMemory, Row), LoadNumber(Operand[1], BaseMemory, Row), LoadNumber(Operand[2], BaseMemory, Row));
+			break;
+		}
+
+		case EScriptablePredicateOp::CompareBooleans:
+		{
+			const bool bA = LoadBool(Operand[0], BaseMemory, Row);
+			const bool bB = LoadBool(Operand[1], BaseMemory, Row);
+			switch (static_cast<EScriptableBoolOp>(Instruction.Operation))
+			{
+				case EScriptableBoolOp::And:      bResult = bA && bB; break;
+				case EScriptableBoolOp::Or:       bResult = bA || bB; break;
+				case EScriptableBoolOp::Xor:      bResult = bA ^ bB; break;
+				case EScriptableBoolOp::Nand:     bResult = !(bA && bB); break;
+				case EScriptableBoolOp::Equal:    bResult = bA == bB; break;
+				case EScriptableBoolOp::NotEqual: bResult = bA != bB; break;
+			}
+			break;
+		}
+
+		case EScriptablePredicateOp::IsValid:
+		{
+			bResult = IsValid(LoadObject(Operand[0], BaseMemory, Row));
+			break;
+		}
+
+		case EScriptablePredicateOp::Distance:
+		{
+			// Operand classes were checked when compiling
+			const AActor* Origin = static_cast<const AActor*>(LoadObject(Operand[0], BaseMemory, Row));
+			const AActor* Target = static_cast<const AActor*>(LoadObject(Operand[1], BaseMemory, Row));
+			if (Origin && Target)
+			{
+				const float ActualDistanceSq = Origin->GetSquaredDistanceTo(Target);
+				const float ThresholdSq = FMath::Square((float)LoadNumber(Operand[2], BaseMemory, Row));
+				bResult = Compare<double>(static_cast<EScriptableComparisonOp>(Instruction.Operation), ActualDistanceSq, ThresholdSq, 1.e-4);
+			}
+			break;
+		}
+
+		case EScriptablePredicateOp::CallOut:
+		{
+			bResult = Instruction.Condition->CheckCondition();
+			break;
+		}
+	}
+
+	return Instruction.bNegate ? !bResult : bResult;
+}
@@ -2,8 +2,226 @@
 
 #include "ScriptableConditions/ScriptableRequirement.h"
 #include "ScriptableConditions/ScriptableCondition.h"
+#include "ScriptableConditions/ScriptableCondition_Group.h"
+#include "ScriptableConditions/ScriptableRequirementAsset.h"
+#include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "ScriptableConditions/ScriptableConditionNode.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Async/Async.h"
+#include "UObject/GCObject.h"
+#include "UObject/Package.h"
 #include "Algo/AllOf.h"
 #include "Algo/AnyOf.h"
+#include "Algo/StableSort.h"
+#include "HAL/IConsoleManager.h"
+
+static bool GScriptableCompileRequirements = false;
+static FAutoConsoleVariableRef CVarScriptableCompileRequirements(
+	TEXT("Scriptable.Requirements.Compile"),
+	GScriptableCompileRequirements,
+	TEXT("If true, every requirement is evaluated through a compiled predicate program, as if bCompileConditions was set."));
+
+static bool GScriptableRequirementStats = false;
+static FAutoConsoleVariableRef CVarScriptableRequirementStats(
+	TEXT("Scriptable.Requirements.Stats"),
+	GScriptableRequirementStats,
+	TEXT("If true, every requirement measures the cost and pass rate of its conditions, even if it does not reorder them."));
+
+static bool GScriptableFlattenRequirements = true;
+static FAutoConsoleVariableRef CVarScriptableFlattenRequirements(
+	TEXT("Scriptable.Requirements.Flatten"),
+	GScriptableFlattenRequirements,
+	TEXT("If true, nested groups and requirement assets are inlined into their parent requirement when it is first registered or evaluated (see FScriptableRequirement::FlattenConditions). Only in game, or on Play In Editor copies."));
+
+static bool GScriptableStatelessRequirements = true;
+static FAutoConsoleVariableRef CVarScriptableStatelessRequirements(
+	TEXT("Scriptable.Requirements.Stateless"),
+	GScriptableStatelessRequirements,
+	TEXT("If true, EvaluateRequirement evaluates without registering the requirement (see FScriptableRequirement::EvaluateStateless). If false, it registers it for every call."));
+
+/** Number of evaluations between two reorders of the conditions. */
+static constexpr int32 ScriptableRequirementReorderInterval = 32;
+
+namespace ScriptableRequirementAsync
+{
+	/**
+	 * Copies of leaf conditions for the snapshots, owned by the game thread and reused across evaluations.
+	 * Copies are only taken and given back on the game thread, and stay referenced while a worker reads them.
+	 */
+	class FCopyPool : public FGCObject
+	{
+	public:
+		static FCopyPool& Get()
+		{
+			// Never destroyed, the GC may not be around anymore on exit
+			static FCopyPool* Pool = new FCopyPool();
+			return *Pool;
+		}
+
+		/** Returns a copy of the properties of Condition, whose bindings must be resolved. */
+		UScriptableCondition* Acquire(const UScriptableCondition* Condition)
+		{
+			check(IsInGameThread());
+
+			UClass* Class = Condition->GetClass();
+
+			TArray<UScriptableCondition*>& FreeCopies = FreeByClass.FindOrAdd(Class);
+			if (FreeCopies.IsEmpty())
+			{
+				UScriptableCondition* Copy = NewObject<UScriptableCondition>(GetTransientPackage(), Class, NAME_None, RF_Transient);
+				Copies.Add(Copy);
+				FreeCopies.Add(Copy);
+			}
+
+			UScriptableCondition* Copy = FreeCopies.Pop(EAllowShrinking::No);
+
+			// Bindings, ids and the Context are only needed to resolve, which the source did already.
+			// Instanced objects are shared with the source, the copy keeps them referenced.
+			for (TFieldIterator<FProperty> It(Class); It; ++It)
+			{
+				if (It->GetOwnerClass() != UScriptableObject::StaticClass())
+				{
+					It->CopyCompleteValue_InContainer(Copy, Condition);
+				}
+			}
+
+			return Copy;
+		}
+
+		void Release(TConstArrayView<UScriptableCondition*> InCopies)
+		{
+			check(IsInGameThread());
+
+			for (UScriptableCondition* Copy : InCopies)
+			{
+				FreeByClass.FindOrAdd(Copy->GetClass()).Add(Copy);
+			}
+		}
+
+		virtual void AddReferencedObjects(FReferenceCollector& Collector) override
+		{
+			Collector.AddReferencedObjects(Copies);
+		}
+
+		virtual FString GetReferencerName() const override
+		{
+			return TEXT("ScriptableRequirementAsync::FCopyPool");
+		}
+
+	private:
+		/** Every copy, free or in use. */
+		TArray<TObjectPtr<UScriptableCondition>> Copies;
+
+		TMap<const UClass*, TArray<UScriptableCondition*>> FreeByClass;
+	};
+
+	/** Copy of a requirement and its nested groups, with the bindings resolved, evaluated off the game thread. */
+	struct FSnapshot
+	{
+		struct FEntry
+		{
+			/** Copy of a leaf condition. */
+			UScriptableCondition* Condition = nullptr;
+
+			/** Index of a nested group, if Condition is not set. */
+			int32 Group = INDEX_NONE;
+		};
+
+		struct FGroup
+		{
+			bool bAnd = true;
+			bool bNegate = false;
+			TArray<FEntry> Entries;
+		};
+
+		/** Groups[0] is the requirement itself. */
+		TArray<FGroup> Groups;
+
+		/** Pooled copies, given back by Release on the game thread once the evaluation is done. */
+		TArray<UScriptableCondition*> Copies;
+
+		void Release()
+		{
+			FCopyPool::Get().Release(Copies);
+			Copies.Reset();
+			Groups.Reset();
+		}
+
+		int32 AddGroup(const FScriptableRequirement& Requirement, bool bConditionNegated)
+		{
+			const int32 GroupIndex = Groups.AddDefaulted();
+			Groups[GroupIndex].bAnd = Requirement.Mode == EScriptableRequirementMode::And;
+			Groups[GroupIndex].bNegate = Requirement.bNegate != bConditionNegated;
+
+			for (UScriptableCondition* Condition : Requirement.Conditions)
+			{
+				if (!Condition)
+				{
+					continue;
+				}
+
+				// Nested groups are expanded rather than copied, as copying them would instance their conditions again
+				if (const UScriptableCondition_Asset* AssetCondition = Cast<UScriptableCondition_Asset>(Condition))
+				{
+					FEntry Entry;
+					if (const UScriptableCondition_Group* Instance = Cast<UScriptableCondition_Group>(AssetCondition->GetInstance()))
+					{
+						// The instance group negation is applied by CheckCondition, then the asset condition one
+						Entry.Group = AddGroup(Instance->Requirement, Instance->IsNegated() != AssetCondition->IsNegated());
+					}
+					else
+					{
+						// Without asset the condition fails, before its negation
+						Entry.Group = Groups.AddDefaulted();
+						Groups[Entry.Group].bAnd = false;
+						Groups[Entry.Group].bNegate = AssetCondition->IsNegated();
+					}
+					Groups[GroupIndex].Entries.Add(Entry);
+				}
+				else if (const UScriptableCondition_Group* Group = Cast<UScriptableCondition_Group>(Condition))
+				{
+					FEntry Entry;
+					Entry.Group = AddGroup(Group->Requirement, Group->IsNegated());
+					Groups[GroupIndex].Entries.Add(Entry);
+				}
+				else
+				{
+					Condition->ResolveBindings();
+
+					UScriptableCondition* Copy = FCopyPool::Get().Acquire(Condition);
+					Copies.Add(Copy);
+
+					FEntry Entry;
+					Entry.Condition = Copy;
+					Groups[GroupIndex].Entries.Add(Entry);
+				}
+			}
+
+			return GroupIndex;
+		}
+
+		bool Evaluate(int32 GroupIndex = 0) const
+		{
+			const FGroup& Group = Groups[GroupIndex];
+
+			// AND: Empty = True, OR: Empty = False
+			bool bResult = Group.bAnd;
+
+			for (const FEntry& Entry : Group.Entries)
+			{
+				const bool bPassed = Entry.Condition ? Entry.Condition->CheckSnapshot() : Evaluate(Entry.Group);
+				if (bPassed != Group.bAnd)
+				{
+					bResult = !Group.bAnd;
+					break;
+				}
+			}
+
+			return Group.bNegate ? !bResult : bResult;
+		}
+	};
+}
 
 void FScriptableRequirement::Register(UObject* InOwner)
 {
@@ -12,6 +230,8 @@ void FScriptableRequirement::Register(UObject* InOwner)
 		return;
 	}
 
+	FlattenForRuntime();
+
 	Super::Register(InOwner);
 
 	// Filter invalid conditions
@@ -37,6 +257,19 @@ void FScriptableRequirement::Register(UObject* InOwner)
 		}
 	}
 
+	SortBindingSources();
+
+	RegisterConditionNodes();
+
+	// Statistics survive re-registration (e.g. EvaluateRequirement), unless the conditions changed
+	if (ConditionStats.Num() != Conditions.Num())
+	{
+		ResetConditionStats();
+	}
+
+	bConditionsCacheable = IsCacheable();
+	Invalidate();
+
 	bIsRegistered = true;
 }
 
@@ -47,6 +280,8 @@ void FScriptableRequirement::Unregister()
 		return;
 	}
 
+	StopWatching();
+
 	for (UScriptableCondition* Condition : Conditions)
 	{
 		if (Condition && Condition->IsEnabled())
@@ -55,12 +290,46 @@ void FScriptableRequirement::Unregister()
 		}
 	}
 
+	UnregisterConditionNodes();
+
+	Program.Reset();
+	Invalidate();
+
+	RestoreAuthoredConditions();
+
 	bIsRegistered = false;
 	Super::Unregister();
 }
 
 bool FScriptableRequirement::Evaluate() const
 {
+	if (bCacheResult && bConditionsCacheable && bIsRegistered)
+	{
+		const uint64 ContextVersion = GetContextVersion().Get();
+		if (CachedFrame != GFrameCounter || CachedContextVersion != ContextVersion)
+		{
+			bCachedResult = EvaluateUncached();
+			CachedFrame = GFrameCounter;
+			CachedContextVersion = ContextVersion;
+		}
+		return bCachedResult;
+	}
+
+	return EvaluateUncached();
+}
+
+bool FScriptableRequirement::EvaluateUncached() const
+{
+	if (bIsRegistered && (bCompileConditions || GScriptableCompileRequirements) && ConditionNodes.IsEmpty())
+	{
+		// Recompiled if a Context was rebuilt with a different layout
+		if (!Program.IsUpToDate())
+		{
+			Program.Compile(*this);
+		}
+		return Program.Execute();
+	}
+
 	bool bResult = true;
 
 	if (Conditions.IsEmpty())
@@ -68,6 +337,10 @@ bool FScriptableRequirement::Evaluate() const
 		// AND: Empty = True, OR: Empty = False
 		bResult = (Mode == EScriptableRequirementMode::And);
 	}
+	else if (bReorderConditions || GScriptableRequirementStats)
+	{
+		bResult = EvaluateMeasured();
+	}
 	else
 	{
 		auto EvalPredicate = [](UScriptableCondition* Condition)
@@ -85,11 +358,605 @@ bool FScriptableRequirement::Evaluate() const
 		}
 	}
 
+	// The nodes come after the conditions, and only matter if these did not decide the result
+	if (!ConditionNodes.IsEmpty() && bResult == (Mode == EScriptableRequirementMode::And))
+	{
+		bResult = EvaluateConditionNodes();
+	}
+
 	return bNegate ? !bResult : bResult;
 }
 
+bool FScriptableRequirement::EvaluateConditionNodes() const
+{
+	const bool bAnd = (Mode == EScriptableRequirementMode::And);
+
+	for (const FInstancedStruct& Instance : ConditionNodes)
+	{
+		// Resolving the bindings writes into the node, as it does into the condition objects
+		FScriptableConditionNode* Node = const_cast<FInstancedStruct&>(Instance).GetMutablePtr<FScriptableConditionNode>();
+
+		// Disabled nodes are skipped, invalid ones fail like missing conditions
+		if (Node && !Node->IsEnabled())
+		{
+			continue;
+		}
+
+		const bool bPassed = Node ? Node->CheckCondition() : false;
+		if (bPassed != bAnd)
+		{
+			return !bAnd;
+		}
+	}
+
+	return bAnd;
+}
+
+void FScriptableRequirement::RegisterConditionNodes()
+{
+	FScriptableNodeContext NodeContext;
+	NodeContext.Owner = Owner;
+	GetChildContext(NodeContext.Context, NodeContext.ContextVersion);
+
+	for (FInstancedStruct& Instance : ConditionNodes)
+	{
+		FScriptableConditionNode* Node = Instance.GetMutablePtr<FScriptableConditionNode>();
+		if (Node && Node->IsEnabled())
+		{
+			Node->Register(Instance, NodeContext);
+		}
+	}
+}
+
+void FScriptableRequirement::UnregisterConditionNodes()
+{
+	for (FInstancedStruct& Instance : ConditionNodes)
+	{
+		if (FScriptableConditionNode* Node = Instance.GetMutablePtr<FScriptableConditionNode>())
+		{
+			Node->Unregister();
+		}
+	}
+}
+
+bool FScriptableRequirement::IsOrderSensitive() const
+{
+	return Algo::AnyOf(Conditions, [](const UScriptableCondition* Condition) { return Condition && Condition->IsOrderSensitive(); });
+}
+
+bool FScriptableRequirement::IsCacheable() const
+{
+	return Algo::AllOf(Conditions, [](const UScriptableCondition* Condition) { return !Condition || Condition->IsCacheable(); })
+		&& Algo::AllOf(ConditionNodes, [](const FInstancedStruct& Instance) { const FScriptableConditionNode* Node = Instance.GetPtr<FScriptableConditionNode>(); return !Node || Node->IsCacheable(); });
+}
+
+bool FScriptableRequirement::DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const
+{
+	bool bComplete = true;
+
+	for (UScriptableCondition* Condition : Conditions)
+	{
+		// Disabled conditions are never evaluated
+		if (Condition && Condition->IsEnabled())
+		{
+			// Short-circuit or compiled evaluation may have skipped them, sources can depend on the bound values
+			Condition->ResolveBindings();
+			bComplete &= Condition->DeclareInvalidationSources(Sources);
+		}
+	}
+
+	// Nodes don't declare sources, so any enabled one can change the result unnoticed
+	for (const FInstancedStruct& Instance : ConditionNodes)
+	{
+		const FScriptableConditionNode* Node = Instance.GetPtr<FScriptableConditionNode>();
+		if (Node && Node->IsEnabled())
+		{
+			bComplete = false;
+			break;
+		}
+	}
+
+	return bComplete;
+}
+
+bool FScriptableRequirement::StartWatching()
+{
+	if (!ensureMsgf(bIsRegistered, TEXT("Requirements must be registered before watching them.")))
+	{
+		return false;
+	}
+
+	if (bWatching)
+	{
+		return bWatchComplete;
+	}
+
+	bWatching = true;
+	WatchSources.SetCallback(FSimpleDelegate::CreateRaw(this, &FScriptableRequirement::HandleWatchInvalidated));
+
+	Invalidate();
+	bWatchedResult = Evaluate();
+	bWatchComplete = DeclareInvalidationSources(WatchSources);
+
+	return bWatchComplete;
+}
+
+void FScriptableRequirement::StopWatching()
+{
+	if (!bWatching)
+	{
+		return;
+	}
+
+	WatchSources.Reset();
+	WatchSources.SetCallback(FSimpleDelegate());
+	bWatching = false;
+	bWatchDirty = false;
+}
+
+void FScriptableRequirement::HandleWatchInvalidated()
+{
+	if (bInWatchUpdate)
+	{
+		// A source fired while evaluating or from OnResultChanged, evaluated again once done
+		bWatchDirty = true;
+		return;
+	}
+
+	TGuardValue<bool> UpdateGuard(bInWatchUpdate, true);
+
+	do
+	{
+		bWatchDirty = false;
+
+		// Sources other than the Context don't change the Context version
+		Invalidate();
+		const bool bResult = Evaluate();
+
+		// Sources can depend on the values just read (e.g. the actor to watch)
+		WatchSources.Reset();
+		bWatchComplete = DeclareInvalidationSources(WatchSources);
+
+		if (bResult != bWatchedResult)
+		{
+			bWatchedResult = bResult;
+			OnResultChanged.Broadcast(bResult);
+		}
+	}
+	while (bWatchDirty && bWatching);
+}
+
+bool FScriptableRequirement::IsThreadSafe() const
+{
+	// Nodes are not copied into the async snapshot
+	return ConditionNodes.IsEmpty() && Algo::AllOf(Conditions, [](const UScriptableCondition* Condition) { return !Condition || Condition->CanEvaluateOffGameThread(); });
+}
+
+bool FScriptableRequirement::SupportsStatelessEvaluation() const
+{
+	return Algo::AllOf(Conditions, [](const UScriptableCondition* Condition) { return !Condition || Condition->SupportsStatelessEvaluation(); });
+}
+
+namespace ScriptableRequirementFlatten
+{
+	/** Returns true if any of the conditions binds to an output of Source. */
+	static bool IsBindingSource(TConstArrayView<TObjectPtr<UScriptableCondition>> Conditions, const UScriptableCondition* Source)
+	{
+		const FGuid SourceID = Source->GetBindingID();
+		return Algo::AnyOf(Conditions, [&SourceID](const UScriptableCondition* Condition)
+			{
+				return Condition && Condition->GetPropertyBindings().Bindings.ContainsByPredicate([&SourceID](const FScriptablePropertyBinding& Binding) { return Binding.SourceID == SourceID; });
+			});
+	}
+
+	/**
+	 * Returns true if a nested requirement can be replaced by its children in a parent with ParentMode.
+	 * NOT(a AND b) == (NOT a) OR (NOT b) and the other way around, so a negated nested requirement fits a parent with the opposite mode.
+	 */
+	static bool CanInline(EScriptableRequirementMode ParentMode, EScriptableRequirementMode NestedMode, bool bNegated, int32 NumChildren)
+	{
+		return NumChildren == 1 || (NestedMode == ParentMode) != bNegated;
+	}
+}
+
+int32 FScriptableRequirement::FlattenConditions()
+{
+	TArray<const UScriptableRequirementAsset*, TInlineAllocator<4>> AssetStack;
+	return FlattenConditionsInternal(AssetStack);
+}
+
+int32 FScriptableRequirement::FlattenConditionsInternal(TArray<const UScriptableRequirementAsset*, TInlineAllocator<4>>& AssetStack)
+{
+	using namespace ScriptableRequirementFlatten;
+
+	int32 NumInlined = 0;
+
+	for (int32 Index = 0; Index < Conditions.Num();)
+	{
+		UScriptableCondition* Condition = Conditions[Index];
+		if (!Condition || !Condition->IsEnabled())
+		{
+			++Index;
+			continue;
+		}
+
+		FScriptableRequirement* Nested = nullptr;
+		UScriptableCondition_Group* AssetGroup = nullptr;
+
+		// Siblings may bind to the nested condition itself, and a Context of its own is a new scope for the bindings of its children
+		if (UScriptableCondition_Group* Group = Cast<UScriptableCondition_Group>(Condition))
+		{
+			if (Group->Requirement.ContextDefinitions.IsEmpty() && Group->Requirement.ConditionNodes.IsEmpty() && !IsBindingSource(Conditions, Condition))
+			{
+				Nested = &Group->Requirement;
+			}
+		}
+		else if (UScriptableCondition_Asset* AssetCondition = Cast<UScriptableCondition_Asset>(Condition))
+		{
+			const UScriptableRequirementAsset* Asset = AssetCondition->Asset;
+			if (Asset && !AssetStack.Contains(Asset) && !IsBindingSource(Conditions, Condition))
+			{
+				// Same copies OnRegister would make, but once, in a group that reads the parent Context directly
+				AssetGroup = NewObject<UScriptableCondition_Group>(Condition->GetOuter(), NAME_None, RF_Transient);
+				AssetGroup->GroupName = Asset->GetName();
+				AssetGroup->SetNegated(AssetCondition->IsNegated());
+				AssetGroup->Requirement.Mode = Asset->Requirement.Mode;
+				AssetGroup->Requirement.bNegate = Asset->Requirement.bNegate;
+				AssetGroup->Requirement.bCompileConditions = Asset->Requirement.bCompileConditions;
+				AssetGroup->Requirement.bReorderConditions = Asset->Requirement.bReorderConditions;
+				AssetGroup->Requirement.bCacheResult = Asset->Requirement.bCacheResult;
+				AssetGroup->Requirement.ConditionNodes = Asset->Requirement.ConditionNodes;
+
+				for (const UScriptableCondition* SourceCondition : Asset->Requirement.Conditions)
+				{
+					if (SourceCondition)
+					{
+						// Transient like their group, they must not be saved with the owner nor dirty its package
+						FObjectDuplicationParameters Params = InitStaticDuplicateObjectParams(SourceCondition, Condition->GetOuter());
+						Params.ApplyFlags |= RF_Transient;
+						AssetGroup->Requirement.Conditions.Add(CastChecked<UScriptableCondition>(StaticDuplicateObjectEx(Params)));
+					}
+				}
+
+				AssetStack.Push(Asset);
+				NumInlined += AssetGroup->Requirement.FlattenConditionsInternal(AssetStack);
+				AssetStack.Pop();
+
+				Nested = &AssetGroup->Requirement;
+			}
+		}
+
+		if (!Nested)
+		{
+			++Index;
+			continue;
+		}
+
+		if (!AssetGroup)
+		{
+			NumInlined += Nested->FlattenConditionsInternal(AssetStack);
+		}
+		Nested->bFlattened = true;
+
+		Nested->Conditions.RemoveAll([](const TObjectPtr<UScriptableCondition>& Child) { return !Child; });
+
+		const UScriptableCondition* NestedCondition = AssetGroup ? AssetGroup : Condition;
+		const bool bNegated = NestedCondition->IsNegated() != Nested->bNegate;
+
+		// Empty requirements are constants, left as they are. Nodes can't be inlined, they keep their group.
+		if (Nested->Conditions.IsEmpty() || !Nested->ConditionNodes.IsEmpty() || !CanInline(Mode, Nested->Mode, bNegated, Nested->Conditions.Num()))
+		{
+			if (AssetGroup)
+			{
+				Conditions[Index] = AssetGroup;
+			}
+			++Index;
+			continue;
+		}
+
+		TArray<UScriptableObject*, TInlineAllocator<8>> Children;
+		for (UScriptableCondition* Child : Nested->Conditions)
+		{
+			if (bNegated)
+			{
+				Child->SetNegated(!Child->IsNegated());
+			}
+			Children.Add(Child);
+		}
+
+		// The IDs only had to be unique in the nested requirement, and copies of an asset share the IDs of the asset
+		UScriptableObject::RegenerateBindingIDs(Children);
+
+		const int32 NumChildren = Nested->Conditions.Num();
+		TArray<TObjectPtr<UScriptableCondition>> Inlined = MoveTemp(Nested->Conditions);
+
+		Conditions.RemoveAt(Index);
+		Conditions.Insert(Inlined, Index);
+
+		Index += NumChildren;
+		NumInlined += NumChildren;
+	}
+
+	return NumInlined;
+}
+
+void FScriptableRequirement::FlattenForRuntime()
+{
+	if (!bFlattened)
+	{
+		bFlattened = true;
+
+		// The editor edits authored requirements in place, only the copies made for play are flattened
+		const bool bCanFlatten = GScriptableFlattenRequirements
+			&& (!GIsEditor || Algo::AllOf(Conditions, [](const UScriptableCondition* Condition) { return !Condition || Condition->GetPackage()->HasAnyPackageFlags(PKG_PlayInEditor); }));
+
+		if (bCanFlatten)
+		{
+			// Flattening rewrites the groups it descends into (their conditions, negation and binding IDs),
+			// so it works on transient copies of them. Conditions at this level and assets are only referenced.
+			TArray<TObjectPtr<UScriptableCondition>> Authored = Conditions;
+			for (TObjectPtr<UScriptableCondition>& Condition : Conditions)
+			{
+				if (Condition && Condition->IsEnabled() && Condition->IsA<UScriptableCondition_Group>())
+				{
+					FObjectDuplicationParameters Params = InitStaticDuplicateObjectParams(Condition, Condition->GetOuter());
+					Params.ApplyFlags |= RF_Transient;
+					Condition = CastChecked<UScriptableCondition>(StaticDuplicateObjectEx(Params));
+				}
+			}
+
+			const TArray<TObjectPtr<UScriptableCondition>> Copies = Conditions;
+			const int32 NumInlined = FlattenConditions();
+
+			// Copies that changed nothing are dropped
+			bHasFlattenedConditions = NumInlined > 0 || Conditions != Copies;
+			if (bHasFlattenedConditions)
+			{
+				SwappedConditions = MoveTemp(Conditions);
+			}
+			Conditions = MoveTemp(Authored);
+		}
+	}
+
+	if (bHasFlattenedConditions && !bFlattenedInUse)
+	{
+		Swap(Conditions, SwappedConditions);
+		bFlattenedInUse = true;
+	}
+}
+
+void FScriptableRequirement::RestoreAuthoredConditions()
+{
+	if (bFlattenedInUse)
+	{
+		Swap(Conditions, SwappedConditions);
+		bFlattenedInUse = false;
+	}
+}
+
+UE::Tasks::TTask<bool> FScriptableRequirement::EvaluateAsync() const
+{
+	using namespace ScriptableRequirementAsync;
+
+	check(IsInGameThread());
+
+	if (!IsThreadSafe())
+	{
+		const bool bResult = Evaluate();
+		return UE::Tasks::Launch(UE_SOURCE_LOCATION, [bResult]() { return bResult; });
+	}
+
+	TSharedRef<FSnapshot> Snapshot = MakeShared<FSnapshot>();
+	Snapshot->AddGroup(*this, false);
+
+	return UE::Tasks::Launch(UE_SOURCE_LOCATION, [Snapshot]()
+		{
+			// Objects read by the copies (e.g. bound actors) are kept alive by the pool, which references the copies
+			const bool bResult = Snapshot->Evaluate();
+
+			// The copies go back to the pool on the game thread, which owns it
+			AsyncTask(ENamedThreads::GameThread, [Snapshot]() { Snapshot->Release(); });
+
+			return bResult;
+		});
+}
+
+void FScriptableRequirement::EvaluateAsync(FOnScriptableRequirementEvaluated OnCompleted) const
+{
+	UE::Tasks::TTask<bool> Task = EvaluateAsync();
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Task, OnCompleted = MoveTemp(OnCompleted)]() mutable
+		{
+			AsyncTask(ENamedThreads::GameThread, [bResult = Task.GetResult(), OnCompleted = MoveTemp(OnCompleted)]()
+				{
+					OnCompleted.ExecuteIfBound(bResult);
+				});
+		},
+		UE::Tasks::Prerequisites(Task));
+}
+
+void FScriptableRequirement::ResetConditionStats() const
+{
+	ConditionStats.Reset();
+	ConditionStats.SetNum(Conditions.Num());
+
+	EvaluationOrder.Reset(Conditions.Num());
+	for (int32 Index = 0; Index < Conditions.Num(); ++Index)
+	{
+		EvaluationOrder.Add(Index);
+	}
+
+	EvaluationsSinceReorder = 0;
+}
+
+bool FScriptableRequirement::EvaluateMeasured() const
+{
+	if (EvaluationOrder.Num() != Conditions.Num())
+	{
+		ResetConditionStats();
+	}
+
+	const bool bAnd = (Mode == EScriptableRequirementMode::And);
+	bool bResult = bAnd;
+
+	for (const int32 Index : EvaluationOrder)
+	{
+		UScriptableCondition* Condition = Conditions[Index];
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		const bool bPassed = Condition ? Condition->CheckCondition() : false;
+		ConditionStats[Index].AddSample(FPlatformTime::Cycles64() - StartCycles, bPassed);
+
+		// AND stops on the first failure, OR on the first success
+		if (bPassed != bAnd)
+		{
+			bResult = !bAnd;
+			break;
+		}
+	}
+
+	if (bReorderConditions && ++EvaluationsSinceReorder >= ScriptableRequirementReorderInterval)
+	{
+		ReorderConditions();
+	}
+
+	return bResult;
+}
+
+void FScriptableRequirement::ReorderConditions() const
+{
+	EvaluationsSinceReorder = 0;
+
+	// Expected cost paid per evaluation that decides the result. Unmeasured conditions go first so they get measured.
+	const bool bAnd = (Mode == EScriptableRequirementMode::And);
+	auto GetScore = [this, bAnd](int32 Index)
+	{
+		const FScriptableConditionStats& Stats = ConditionStats[Index];
+		if (Stats.NumEvaluations == 0)
+		{
+			return 0.0;
+		}
+
+		const double DecideRate = bAnd ? 1.0 - Stats.PassRate : Stats.PassRate;
+		return Stats.AverageCycles / FMath::Max(DecideRate, UE_KINDA_SMALL_NUMBER);
+	};
+
+	// Order sensitive conditions split the list, so the same conditions are always evaluated before and after them
+	int32 SegmentStart = 0;
+	for (int32 Position = 0; Position <= EvaluationOrder.Num(); ++Position)
+	{
+		const bool bSegmentEnd = Position == EvaluationOrder.Num() || (Conditions[EvaluationOrder[Position]] && Conditions[EvaluationOrder[Position]]->IsOrderSensitive());
+		if (!bSegmentEnd)
+		{
+			continue;
+		}
+
+		TArrayView<int32> Segment = MakeArrayView(EvaluationOrder).Slice(SegmentStart, Position - SegmentStart);
+		Algo::StableSortBy(Segment, GetScore);
+
+		SegmentStart = Position + 1;
+	}
+}
+
+bool FScriptableRequirement::EvaluateUnregistered(UObject* InOwner)
+{
+	FlattenForRuntime();
+
+	Owner = InOwner;
+
+	// Same filtering as Register
+	Conditions.RemoveAll([](const TObjectPtr<UScriptableCondition>& Condition) { return !Condition; });
+
+	if (ConditionStats.Num() != Conditions.Num())
+	{
+		ResetConditionStats();
+	}
+
+	const FInstancedPropertyBag* ChildContext = nullptr;
+	const FScriptableDataVersion* ChildContextVersion = nullptr;
+	GetChildContext(ChildContext, ChildContextVersion);
+
+	// Sibling sources are looked up in a map on the stack, only filled if a condition reads a sibling. Compiled bindings cache what they found.
+	TMap<FGuid, TObjectPtr<UScriptableObject>> LocalSources;
+	for (UScriptableCondition* Condition : Conditions)
+	{
+		const bool bReadsSibling = Condition->GetPropertyBindings().Bindings.ContainsByPredicate([](const FScriptablePropertyBinding& Binding) { return Binding.SourceID.IsValid(); });
+		if (bReadsSibling)
+		{
+			for (UScriptableCondition* Source : Conditions)
+			{
+				LocalSources.Add(Source->GetBindingID(), Source);
+			}
+			break;
+		}
+	}
+
+	for (UScriptableCondition* Condition : Conditions)
+	{
+		Condition->BeginStatelessUse(InOwner, ChildContext, LocalSources.IsEmpty() ? nullptr : &LocalSources, ChildContextVersion);
+	}
+
+	// Later calls reuse the compiled bindings, plans are also recompiled lazily if a nested bag changes its layout
+	const UStruct* Layout = ChildContext ? ChildContext->GetPropertyBagStruct() : nullptr;
+	if (!bStatelessCompiled || StatelessLayout != Layout)
+	{
+		for (UScriptableCondition* Condition : Conditions)
+		{
+			Condition->CompileBindings();
+		}
+		StatelessLayout = Layout;
+		bStatelessCompiled = true;
+	}
+
+	// Nodes have no world registration, registering them is just binding them to the Context
+	RegisterConditionNodes();
+
+	const bool bResult = EvaluateUncached();
+
+	UnregisterConditionNodes();
+
+	for (UScriptableCondition* Condition : Conditions)
+	{
+		Condition->EndStatelessUse();
+	}
+
+	RestoreAuthoredConditions();
+
+	Owner = nullptr;
+
+	return bResult;
+}
+
+bool FScriptableRequirement::EvaluateStateless(UObject* Owner, const FScriptableRequirement& Requirement)
+{
+	if (!Owner) return false;
+
+	FScriptableRequirement& MutableReq = const_cast<FScriptableRequirement&>(Requirement);
+
+	if (MutableReq.bIsRegistered)
+	{
+		return MutableReq.Evaluate();
+	}
+
+	if (!MutableReq.SupportsStatelessEvaluation())
+	{
+		MutableReq.Register(Owner);
+		const bool bResult = MutableReq.Evaluate();
+		MutableReq.Unregister();
+
+		return bResult;
+	}
+
+	return MutableReq.EvaluateUnregistered(Owner);
+}
+
 bool FScriptableRequirement::EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement)
 {
+	if (GScriptableStatelessRequirements)
+	{
+		return EvaluateStateless(Owner, Requirement);
+	}
+
 	if (!Owner) return false;
 
 	FScriptableRequirement& MutableReq = const_cast<FScriptableRequirement&>(Requirement);
@@ -99,4 +966,122 @@ bool FScriptableRequirement::EvaluateRequirement(UObject* Owner, const FScriptab
 	MutableReq.Unregister();
 
 	return bResult;
-}
\ No newline at end of file
+}
+
+bool FScriptableRequirement::EvaluateBatch(UObject* Owner, const FScriptableRequirement& Requirement, const FScriptableContextTable& Table, TBitArray<>& OutResults)
+{
+	OutResults.Init(false, Table.Num());
+
+	if (!Owner) return false;
+
+	// The program only covers the condition objects
+	if (!Requirement.ConditionNodes.IsEmpty())
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("EvaluateBatch: requirements with condition nodes can't be evaluated in batch."));
+		return false;
+	}
+
+	// A requirement registered by its owner stays registered, only one registered here is unregistered afterwards
+	FScriptableRequirement& MutableReq = const_cast<FScriptableRequirement&>(Requirement);
+	const bool bWasRegistered = MutableReq.bIsRegistered;
+	if (!bWasRegistered)
+	{
+		MutableReq.Register(Owner);
+	}
+
+	// Own program, its Context operands are redirected to the table columns
+	FScriptablePredicateProgram BatchProgram;
+	BatchProgram.Compile(MutableReq);
+
+	const bool bBound = BatchProgram.BindContextTable(MutableReq, Table);
+	if (bBound)
+	{
+		BatchProgram.ExecuteBatch(Table, MutableReq, OutResults);
+	}
+
+	if (!bWasRegistered)
+	{
+		MutableReq.Unregister();
+	}
+
+	return bBound;
+}
+
+#if WITH_EDITOR
+/**
+ * Benchmark of one-shot EvaluateRequirement calls, registering the requirement on every call against the stateless path.
+ * The requirement holds a battery of UScriptableCondition_CompareNumbers bound to two doubles of its Context, owned by the world settings.
+ * Usage: Scriptable.Bench.StatelessRequirements [NumConditions] [Iterations]
+ */
+static void BenchmarkStatelessRequirements(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 NumConditions = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 8;
+	const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 10000;
+
+	AWorldSettings* Owner = World ? World->GetWorldSettings() : nullptr;
+	if (!Owner)
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("Scriptable.Bench.StatelessRequirements: needs a world."));
+		return;
+	}
+
+	const FName NameA = GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, A);
+	const FName NameB = GET_MEMBER_NAME_CHECKED(UScriptableCondition_CompareNumbers, B);
+
+	FScriptableRequirement Requirement;
+	Requirement.GetContext().AddProperty(NameA, EPropertyBagPropertyType::Double);
+	Requirement.GetContext().AddProperty(NameB, EPropertyBagPropertyType::Double);
+	Requirement.GetContext().SetValueDouble(NameA, 1.0);
+	Requirement.GetContext().SetValueDouble(NameB, 2.0);
+
+	for (int32 i = 0; i < NumConditions; ++i)
+	{
+		UScriptableCondition_CompareNumbers* Condition = NewObject<UScriptableCondition_CompareNumbers>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		for (const FName Name : { NameA, NameB })
+		{
+			FPropertyBindingPath Path;
+			Path.AddPathSegment(Name);
+			Condition->GetPropertyBindings().AddPropertyBinding(Path, Path);
+		}
+
+		Requirement.Conditions.Add(Condition);
+	}
+
+	auto Run = [&](bool bStateless, bool& bOutResult)
+		{
+			const bool bWasStateless = GScriptableStatelessRequirements;
+			GScriptableStatelessRequirements = bStateless;
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				bOutResult = FScriptableRequirement::EvaluateRequirement(Owner, Requirement);
+			}
+			const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+			GScriptableStatelessRequirements = bWasStateless;
+			return Ms;
+		};
+
+	bool bRegisteredResult = false, bStatelessResult = false;
+	const double RegisteredMs = Run(false, bRegisteredResult);
+	const double StatelessMs = Run(true, bStatelessResult);
+
+	UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Bench.StatelessRequirements (%d conditions x %d calls): registered %.3f ms (%.1f ns/call), stateless %.3f ms (%.1f ns/call), speedup x%.2f"),
+		NumConditions, Iterations,
+		RegisteredMs, RegisteredMs * 1.0e6 / Iterations,
+		StatelessMs, StatelessMs * 1.0e6 / Iterations,
+		StatelessMs > 0.0 ? RegisteredMs / StatelessMs : 0.0);
+
+	if (bRegisteredResult != bStatelessResult)
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("Scriptable.Bench.StatelessRequirements: registered and stateless results differ."));
+	}
+}
+
+static FAutoConsoleCommand BenchmarkStatelessRequirementsCommand(
+	TEXT("Scriptable.Bench.StatelessRequirements"),
+	TEXT("Compares one-shot EvaluateRequirement calls registering the requirement against the stateless path. Usage: Scriptable.Bench.StatelessRequirements [NumConditions] [Iterations]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkStatelessRequirements));
+#endif // WITH_EDITOR
\ No newline at end of file
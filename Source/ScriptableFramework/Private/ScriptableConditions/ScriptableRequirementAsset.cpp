@@ -20,6 +20,10 @@ void UScriptableCondition_Asset::OnRegister()
 			// This performs a copy of the PropertyBag, preserving default values from the Asset.
 			Group->Requirement.Mode = Asset->Requirement.Mode;
 			Group->Requirement.bNegate = Asset->Requirement.bNegate;
+			Group->Requirement.bCompileConditions = Asset->Requirement.bCompileConditions;
+			Group->Requirement.bReorderConditions = Asset->Requirement.bReorderConditions;
+			Group->Requirement.bCacheResult = Asset->Requirement.bCacheResult;
+			Group->Requirement.ConditionNodes = Asset->Requirement.ConditionNodes;
 
 			if (const FInstancedPropertyBag* ParentContext = GetContext())
 			{
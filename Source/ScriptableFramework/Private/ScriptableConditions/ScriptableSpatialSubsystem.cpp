@@ -0,0 +1,375 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableConditions/ScriptableSpatialSubsystem.h"
+#include "ScriptableObject.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static float GScriptableSpatialCellSize = 1000.0f;
+static FAutoConsoleVariableRef CVarScriptableSpatialCellSize(
+	TEXT("Scriptable.Spatial.CellSize"),
+	GScriptableSpatialCellSize,
+	TEXT("Size of the cells of the spatial hash used by the proximity conditions, read when a world starts. Best around the radius usually queried."));
+
+// -------------------------------------------------------------------
+//  FScriptableSpatialHash
+// -------------------------------------------------------------------
+
+FScriptableSpatialHash::FScriptableSpatialHash(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, InvCellSize(1.0 / CellSize)
+{
+}
+
+void FScriptableSpatialHash::Add(int32 Id, const FVector& Location)
+{
+	check(!Elements.IsValidIndex(Id));
+
+	FElement Element;
+	Element.Location = Location;
+	Elements.Insert(Id, Element);
+
+	AddToCell(Id, GetCell(Location));
+}
+
+void FScriptableSpatialHash::Remove(int32 Id)
+{
+	if (Elements.IsValidIndex(Id))
+	{
+		RemoveFromCell(Id);
+		Elements.RemoveAt(Id);
+	}
+}
+
+void FScriptableSpatialHash::Move(int32 Id, const FVector& Location)
+{
+	FElement& Element = Elements[Id];
+	Element.Location = Location;
+
+	const FIntVector NewCell = GetCell(Location);
+	if (NewCell != Element.Cell)
+	{
+		RemoveFromCell(Id);
+		AddToCell(Id, NewCell);
+	}
+}
+
+void FScriptableSpatialHash::AddToCell(int32 Id, const FIntVector& CellCoords)
+{
+	TArray<int32>& Cell = Cells.FindOrAdd(CellCoords);
+
+	FElement& Element = Elements[Id];
+	Element.Cell = CellCoords;
+	Element.IndexInCell = Cell.Add(Id);
+}
+
+void FScriptableSpatialHash::RemoveFromCell(int32 Id)
+{
+	FElement& Element = Elements[Id];
+	TArray<int32>& Cell = Cells.FindChecked(Element.Cell);
+
+	Cell.RemoveAtSwap(Element.IndexInCell, EAllowShrinking::No);
+	if (Cell.IsValidIndex(Element.IndexInCell))
+	{
+		Elements[Cell[Element.IndexInCell]].IndexInCell = Element.IndexInCell;
+	}
+
+	if (Cell.IsEmpty())
+	{
+		Cells.Remove(Element.Cell);
+	}
+
+	Element.IndexInCell = INDEX_NONE;
+}
+
+// -------------------------------------------------------------------
+//  UScriptableSpatialSubsystem
+// -------------------------------------------------------------------
+
+void FScriptableSpatialTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FScriptableSpatialTickFunction::ExecuteTick);
+
+	if (IsValid(Target))
+	{
+		Target->UpdateLocations();
+	}
+}
+
+FString FScriptableSpatialTickFunction::DiagnosticMessage()
+{
+	return TEXT("UScriptableSpatialSubsystem[UpdateLocations]");
+}
+
+FName FScriptableSpatialTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("ScriptableSpatialSubsystem"));
+}
+
+void UScriptableSpatialSubsystem::PostInitialize()
+{
+	Super::PostInitialize();
+
+	CellSize = GScriptableSpatialCellSize;
+
+	UWorld* World = GetWorld();
+	if (World && World->PersistentLevel)
+	{
+		// After movement, so the next frame queries where the actors ended. Only enabled while there are actors.
+		TickFunction.Target = this;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = false;
+		TickFunction.TickGroup = TG_PostUpdateWork;
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+}
+
+void UScriptableSpatialSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	TickFunction.Target = nullptr;
+
+	for (const FEntry& Entry : Entries)
+	{
+		if (AActor* Actor = Entry.Actor.Get())
+		{
+			Actor->OnEndPlay.RemoveDynamic(this, &UScriptableSpatialSubsystem::HandleActorEndPlay);
+		}
+	}
+
+	Entries.Empty();
+	EntryIds.Empty();
+	Grids.Empty();
+
+	Super::Deinitialize();
+}
+
+void UScriptableSpatialSubsystem::RegisterActor(AActor* Actor, FName Group)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (const int32* ExistingId = EntryIds.Find(Actor))
+	{
+		if (Entries[*ExistingId].Group == Group)
+		{
+			return;
+		}
+		RemoveEntry(*ExistingId);
+	}
+
+	const int32 Id = Entries.Add({ Actor, Actor, Group });
+	EntryIds.Add(Actor, Id);
+
+	FScriptableSpatialHash* Grid = Grids.Find(Group);
+	if (!Grid)
+	{
+		Grid = &Grids.Emplace(Group, FScriptableSpatialHash(CellSize));
+	}
+	Grid->Add(Id, Actor->GetActorLocation());
+
+	Actor->OnEndPlay.AddUniqueDynamic(this, &UScriptableSpatialSubsystem::HandleActorEndPlay);
+
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(true);
+	}
+}
+
+void UScriptableSpatialSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (const int32* Id = EntryIds.Find(Actor))
+	{
+		RemoveEntry(*Id);
+	}
+}
+
+void UScriptableSpatialSubsystem::UpdateActor(AActor* Actor)
+{
+	if (const int32* Id = EntryIds.Find(Actor))
+	{
+		Grids.FindChecked(Entries[*Id].Group).Move(*Id, Actor->GetActorLocation());
+	}
+}
+
+void UScriptableSpatialSubsystem::RemoveEntry(int32 Id)
+{
+	const FEntry Entry = Entries[Id];
+
+	if (AActor* Actor = Entry.Actor.Get())
+	{
+		Actor->OnEndPlay.RemoveDynamic(this, &UScriptableSpatialSubsystem::HandleActorEndPlay);
+	}
+
+	FScriptableSpatialHash& Grid = Grids.FindChecked(Entry.Group);
+	Grid.Remove(Id);
+	if (Grid.Num() == 0)
+	{
+		Grids.Remove(Entry.Group);
+	}
+
+	EntryIds.Remove(Entry.Key);
+	Entries.RemoveAt(Id);
+
+	if (Entries.IsEmpty() && TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(false);
+	}
+}
+
+void UScriptableSpatialSubsystem::HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterActor(Actor);
+}
+
+void UScriptableSpatialSubsystem::UpdateLocations()
+{
+	TArray<int32, TInlineAllocator<8>> StaleIds;
+
+	for (TSparseArray<FEntry>::TConstIterator It(Entries); It; ++It)
+	{
+		// Collected without ending play (e.g. removed in the editor)
+		const AActor* Actor = It->Actor.Get();
+		if (!Actor)
+		{
+			StaleIds.Add(It.GetIndex());
+			continue;
+		}
+
+		Grids.FindChecked(It->Group).Move(It.GetIndex(), Actor->GetActorLocation());
+	}
+
+	for (const int32 Id : StaleIds)
+	{
+		RemoveEntry(Id);
+	}
+}
+
+int32 UScriptableSpatialSubsystem::CountActorsInRadius(FName Group, FVector Center, float Radius, AActor* IgnoredActor, int32 MaxCount) const
+{
+	const FScriptableSpatialHash* Grid = Grids.Find(Group);
+	if (!Grid || MaxCount <= 0)
+	{
+		return 0;
+	}
+
+	const int32* IgnoredId = IgnoredActor ? EntryIds.Find(IgnoredActor) : nullptr;
+	const int32 SkippedId = IgnoredId ? *IgnoredId : INDEX_NONE;
+
+	int32 Count = 0;
+	Grid->ForEachInRadius(Center, Radius, [SkippedId, MaxCount, &Count](int32 Id, const FVector&)
+		{
+			if (Id != SkippedId)
+			{
+				++Count;
+			}
+			return Count < MaxCount;
+		});
+
+	return Count;
+}
+
+void UScriptableSpatialSubsystem::FindActorsInRadius(FName Group, const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoredActor) const
+{
+	const FScriptableSpatialHash* Grid = Grids.Find(Group);
+	if (!Grid)
+	{
+		return;
+	}
+
+	Grid->ForEachInRadius(Center, Radius, [this, IgnoredActor, &OutActors](int32 Id, const FVector&)
+		{
+			AActor* Actor = Entries[Id].Actor.Get();
+			if (Actor && Actor != IgnoredActor)
+			{
+				OutActors.Add(Actor);
+			}
+			return true;
+		});
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Benchmark of proximity gating through the spatial hash against testing every pair.
+ * Scatters NumActors points (5000 by default) over a square of 20000 units, then asks for each of them whether any other
+ * is within Radius, and how many are. Also times the per-frame refresh after moving every point a little.
+ * Usage: Scriptable.Bench.SpatialGrid [NumActors] [Radius]
+ */
+static void BenchmarkSpatialGrid(const TArray<FString>& Args)
+{
+	const int32 NumActors = Args.Num() > 0 ? FMath::Max(2, FCString::Atoi(*Args[0])) : 5000;
+	const float Radius = Args.Num() > 1 ? FMath::Max(1.0f, FCString::Atof(*Args[1])) : 500.0f;
+
+	FRandomStream Random(1234);
+
+	TArray<FVector> Locations;
+	Locations.SetNumUninitialized(NumActors);
+	for (FVector& Location : Locations)
+	{
+		Location = FVector(Random.FRandRange(-10000.0f, 10000.0f), Random.FRandRange(-10000.0f, 10000.0f), 0.0);
+	}
+
+	FScriptableSpatialHash Hash(GScriptableSpatialCellSize);
+	for (int32 Id = 0; Id < NumActors; ++Id)
+	{
+		Hash.Add(Id, Locations[Id]);
+	}
+
+	const double RadiusSq = FMath::Square(double(Radius));
+	int32 PairsAny = 0, PairsCount = 0, GridAny = 0, GridCount = 0;
+
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Agent = 0; Agent < NumActors; ++Agent)
+	{
+		int32 Count = 0;
+		for (int32 Other = 0; Other < NumActors; ++Other)
+		{
+			Count += Other != Agent && FVector::DistSquared(Locations[Agent], Locations[Other]) <= RadiusSq;
+		}
+		PairsAny += Count > 0;
+		PairsCount += Count;
+	}
+	const double PairsMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Agent = 0; Agent < NumActors; ++Agent)
+	{
+		int32 Count = 0;
+		Hash.ForEachInRadius(Locations[Agent], Radius, [Agent, &Count](int32 Id, const FVector&) { Count += Id != Agent; return true; });
+		GridAny += Count > 0;
+		GridCount += Count;
+	}
+	const double GridMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Id = 0; Id < NumActors; ++Id)
+	{
+		Locations[Id] += FVector(Random.FRandRange(-10.0f, 10.0f), Random.FRandRange(-10.0f, 10.0f), 0.0);
+		Hash.Move(Id, Locations[Id]);
+	}
+	const double UpdateMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Bench.SpatialGrid (%d actors, radius %.0f, cell %.0f): all pairs %.3f ms, grid %.3f ms (%.2f us/agent), speedup x%.2f; refresh %.3f ms. %d agents have a neighbor, %.2f neighbors on average"),
+		NumActors, Radius, Hash.GetCellSize(),
+		PairsMs, GridMs, GridMs * 1.0e3 / NumActors,
+		GridMs > 0.0 ? PairsMs / GridMs : 0.0,
+		UpdateMs, GridAny, double(GridCount) / NumActors);
+
+	if (PairsAny != GridAny || PairsCount != GridCount)
+	{
+		UE_LOG(LogScriptableObject, Warning, TEXT("Scriptable.Bench.SpatialGrid: grid and all pairs results differ."));
+	}
+}
+
+static FAutoConsoleCommand BenchmarkSpatialGridCommand(
+	TEXT("Scriptable.Bench.SpatialGrid"),
+	TEXT("Compares proximity queries through the spatial hash against testing every pair. Usage: Scriptable.Bench.SpatialGrid [NumActors] [Radius]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkSpatialGrid));
+#endif
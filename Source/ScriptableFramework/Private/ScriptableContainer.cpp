@@ -36,43 +36,185 @@ UScriptableObject* FScriptableContainer::FindBindingSource(const FGuid& InID) co
 	return nullptr;
 }
 
+void FScriptableContainer::GetChildContext(const FInstancedPropertyBag*& OutContext, const FScriptableDataVersion*& OutContextVersion) const
+{
+	OutContext = nullptr;
+	OutContextVersion = nullptr;
+
+	// If our local context is valid and has properties, use it (it acts as the top-most scope).
+	if (Context.IsValid() && Context.GetNumPropertiesInBag() > 0)
+	{
+		OutContext = &Context;
+		OutContextVersion = &ContextVersion;
+	}
+	// Otherwise, try to inherit the context from the Owner (Parent Scope).
+	else if (const UScriptableObject* ScriptableOwner = Cast<UScriptableObject>(Owner))
+	{
+		OutContext = ScriptableOwner->GetContext();
+		OutContextVersion = ScriptableOwner->GetContextVersion();
+	}
+}
+
 void FScriptableContainer::AddBindingSource(UScriptableObject* InSource)
 {
 	if (InSource)
 	{
+		// 1. Determine which Context to pass down.
 		const FInstancedPropertyBag* ContextToUse = nullptr;
+		const FScriptableDataVersion* ContextVersionToUse = nullptr;
+		GetChildContext(ContextToUse, ContextVersionToUse);
 
-		// 1. Determine which Context to pass down.
-		// If our local context is valid and has properties, use it (it acts as the top-most scope).
-		if (Context.IsValid() && Context.GetNumPropertiesInBag() > 0)
+		// 2. Inject Data
+		InSource->InitRuntimeData(ContextToUse, &BindingSourceMap, ContextVersionToUse);
+
+		FGuid ID = InSource->GetBindingID();
+		if (ID.IsValid())
 		{
-			ContextToUse = &Context;
+			BindingSourceMap.Add(ID, InSource);
 		}
-		// Otherwise, try to inherit the context from the Owner (Parent Scope).
-		else if (UScriptableObject* ScriptableOwner = Cast<UScriptableObject>(Owner))
+
+		BindingSourceOrder.Add(InSource);
+
+		// 3. Resolve binding paths once, so runtime copies don't need name lookups
+		InSource->CompileBindings();
+	}
+}
+
+void FScriptableContainer::SortBindingSources()
+{
+	const int32 NumSources = BindingSourceOrder.Num();
+	if (NumSources == 0)
+	{
+		return;
+	}
+
+	// Most containers only bind to the Context, keep their registration cheap
+	const bool bHasSiblingBindings = BindingSourceOrder.ContainsByPredicate([](const UScriptableObject* Source)
 		{
-			ContextToUse = ScriptableOwner->GetContext();
+			return Source->GetPropertyBindings().Bindings.ContainsByPredicate([](const FScriptablePropertyBinding& Binding) { return Binding.SourceID.IsValid(); });
+		});
+
+	if (!bHasSiblingBindings)
+	{
+		for (UScriptableObject* Source : BindingSourceOrder)
+		{
+			Source->BindingDepth = 0;
 		}
+		return;
+	}
 
-		// 2. Inject Data
-		InSource->InitRuntimeData(ContextToUse, &BindingSourceMap);
+	TMap<const UScriptableObject*, int32> IndexOf;
+	IndexOf.Reserve(NumSources);
+	for (int32 i = 0; i < NumSources; ++i)
+	{
+		IndexOf.Add(BindingSourceOrder[i], i);
+	}
 
-		FGuid ID = InSource->GetBindingID();
-		if (ID.IsValid())
+	// Edges go from each source to the siblings reading from it
+	TArray<TArray<int32, TInlineAllocator<4>>> Consumers;
+	TArray<int32> NumPendingSources;
+	Consumers.SetNum(NumSources);
+	NumPendingSources.SetNumZeroed(NumSources);
+
+	for (int32 ConsumerIndex = 0; ConsumerIndex < NumSources; ++ConsumerIndex)
+	{
+		TArray<int32, TInlineAllocator<4>> SourceIndices;
+		for (const FScriptablePropertyBinding& Binding : BindingSourceOrder[ConsumerIndex]->GetPropertyBindings().Bindings)
 		{
-			BindingSourceMap.Add(ID, InSource);
+			if (!Binding.SourceID.IsValid()) continue;
+
+			const UScriptableObject* Source = FindBindingSource(Binding.SourceID);
+			const int32* SourceIndex = Source ? IndexOf.Find(Source) : nullptr;
+			if (SourceIndex && *SourceIndex != ConsumerIndex)
+			{
+				SourceIndices.AddUnique(*SourceIndex);
+			}
 		}
+
+		for (const int32 SourceIndex : SourceIndices)
+		{
+			Consumers[SourceIndex].Add(ConsumerIndex);
+		}
+		NumPendingSources[ConsumerIndex] = SourceIndices.Num();
 	}
+
+	// Kahn's algorithm. The ready set is a min-heap on the registration index, so independent objects keep their authored order.
+	TArray<int32> Ready;
+	TArray<int32> Depths;
+	Depths.SetNumZeroed(NumSources);
+
+	for (int32 i = 0; i < NumSources; ++i)
+	{
+		if (NumPendingSources[i] == 0)
+		{
+			Ready.HeapPush(i);
+		}
+	}
+
+	TArray<TObjectPtr<UScriptableObject>> SortedSources;
+	SortedSources.Reserve(NumSources);
+
+	while (!Ready.IsEmpty())
+	{
+		int32 Index;
+		Ready.HeapPop(Index, EAllowShrinking::No);
+		SortedSources.Add(BindingSourceOrder[Index]);
+
+		for (const int32 ConsumerIndex : Consumers[Index])
+		{
+			Depths[ConsumerIndex] = FMath::Max(Depths[ConsumerIndex], Depths[Index] + 1);
+			if (--NumPendingSources[ConsumerIndex] == 0)
+			{
+				Ready.HeapPush(ConsumerIndex);
+			}
+		}
+	}
+
+	// Whatever is left is part of a cycle, or reads from one. Keep it in authored order after the rest.
+	if (SortedSources.Num() < NumSources)
+	{
+		TStringBuilder<256> CycleNames;
+		int32 MaxDepth = 0;
+		for (const int32 Depth : Depths)
+		{
+			MaxDepth = FMath::Max(MaxDepth, Depth);
+		}
+
+		for (int32 i = 0; i < NumSources; ++i)
+		{
+			if (NumPendingSources[i] > 0)
+			{
+				if (CycleNames.Len() > 0) CycleNames << TEXT(", ");
+				CycleNames << BindingSourceOrder[i]->GetName();
+
+				Depths[i] = MaxDepth + 1;
+				SortedSources.Add(BindingSourceOrder[i]);
+			}
+		}
+
+		UE_LOG(LogScriptableObject, Warning, TEXT("%s: Cyclic sibling bindings between [%s]. These objects are resolved in authored order and may read stale values."),
+			*GetNameSafe(Owner), CycleNames.ToString());
+	}
+
+	for (int32 i = 0; i < NumSources; ++i)
+	{
+		BindingSourceOrder[i]->BindingDepth = Depths[i];
+	}
+
+	BindingSourceOrder = MoveTemp(SortedSources);
 }
 
 void FScriptableContainer::Register(UObject* InOwner)
 {
 	Owner = InOwner;
 	BindingSourceMap.Reset(); // Clean slate
+	BindingSourceOrder.Reset();
+	MarkContextChanged();
 }
 
 void FScriptableContainer::Unregister()
 {
 	BindingSourceMap.Empty();
+	BindingSourceOrder.Empty();
 	Owner = nullptr;
 }
\ No newline at end of file
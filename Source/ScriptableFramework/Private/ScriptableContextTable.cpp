@@ -0,0 +1,77 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableContextTable.h"
+
+void FScriptableContextTable::Init(const FInstancedPropertyBag& Defaults, int32 InNumRows)
+{
+	Reset();
+
+	Layout = Defaults.GetPropertyBagStruct();
+	if (!Layout || InNumRows <= 0)
+	{
+		return;
+	}
+
+	NumRows = InNumRows;
+	const uint8* DefaultsMemory = Defaults.GetValue().GetMemory();
+
+	for (TFieldIterator<FProperty> It(Layout); It; ++It)
+	{
+		const FProperty* Property = *It;
+
+		FColumn& Column = Columns.AddDefaulted_GetRef();
+		Column.Property = Property;
+		Column.Stride = Property->GetElementSize();
+		Column.Data.SetNumUninitialized(Column.Stride * NumRows);
+
+		const uint8* DefaultValue = Property->ContainerPtrToValuePtr<uint8>(DefaultsMemory);
+		for (int32 Row = 0; Row < NumRows; ++Row)
+		{
+			uint8* Value = Column.Data.GetData() + Row * Column.Stride;
+			Property->InitializeValue(Value);
+			Property->CopySingleValue(Value, DefaultValue);
+		}
+	}
+}
+
+void FScriptableContextTable::Reset()
+{
+	for (FColumn& Column : Columns)
+	{
+		if (!Column.Property->HasAnyPropertyFlags(CPF_NoDestructor))
+		{
+			for (int32 Row = 0; Row < NumRows; ++Row)
+			{
+				Column.Property->DestroyValue(Column.Data.GetData() + Row * Column.Stride);
+			}
+		}
+	}
+
+	Columns.Reset();
+	Layout = nullptr;
+	NumRows = 0;
+}
+
+int32 FScriptableContextTable::FindColumn(FName PropertyName) const
+{
+	return Columns.IndexOfByPredicate([PropertyName](const FColumn& Column) { return Column.Property->GetFName() == PropertyName; });
+}
+
+int32 FScriptableContextTable::FindColumnByOffset(int32 Offset) const
+{
+	return Columns.IndexOfByPredicate([Offset](const FColumn& Column)
+		{
+			const int32 PropertyOffset = Column.Property->GetOffset_ForInternal();
+			return Offset >= PropertyOffset && Offset < PropertyOffset + Column.Stride;
+		});
+}
+
+void FScriptableContextTable::CopyRowTo(int32 Row, uint8* BagMemory) const
+{
+	check(Row >= 0 && Row < NumRows);
+
+	for (const FColumn& Column : Columns)
+	{
+		Column.Property->CopySingleValue(Column.Property->ContainerPtrToValuePtr<uint8>(BagMemory), Column.Data.GetData() + Row * Column.Stride);
+	}
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableNode.h"
+#include "ScriptableObject.h"
+#include "Engine/World.h"
+
+UWorld* FScriptableNodeContext::GetWorld() const
+{
+	return Owner ? Owner->GetWorld() : nullptr;
+}
+
+FScriptableNode::FScriptableNode(const FScriptableNode& Other)
+	: bEnabled(Other.bEnabled)
+	, PropertyBindings(Other.PropertyBindings)
+{
+	PropertyBindings.ResetCompiledBindings();
+}
+
+FScriptableNode& FScriptableNode::operator=(const FScriptableNode& Other)
+{
+	if (this != &Other)
+	{
+		bEnabled = Other.bEnabled;
+		PropertyBindings = Other.PropertyBindings;
+		PropertyBindings.ResetCompiledBindings();
+	}
+	return *this;
+}
+
+void FScriptableNode::Register(FStructView Self, const FScriptableNodeContext& InNodeContext)
+{
+	check(Self.GetMemory() == reinterpret_cast<uint8*>(this));
+
+	if (bRegistered)
+	{
+		UE_LOG(LogScriptableObject, Log, TEXT("Register: node (%s) already registered. Aborting."), *GetNameSafe(Self.GetScriptStruct()));
+		return;
+	}
+
+	NodeStruct = Self.GetScriptStruct();
+	NodeContext = InNodeContext;
+	bRegistered = true;
+
+	PropertyBindings.CompileBindings(Self, NodeContext.Context);
+
+	OnRegister();
+}
+
+void FScriptableNode::Unregister()
+{
+	if (!bRegistered)
+	{
+		return;
+	}
+
+	OnUnregister();
+
+	// References point into the Context, which may not outlive the registration
+	PropertyBindings.ReleaseReferences(GetSelfView());
+
+	NodeContext = FScriptableNodeContext();
+	bRegistered = false;
+}
+
+void FScriptableNode::ResolveBindings()
+{
+	if (bRegistered)
+	{
+		PropertyBindings.ResolveBindings(GetSelfView(), NodeContext.Context, NodeContext.ContextVersion);
+	}
+}
@@ -2,6 +2,8 @@
 
 #include "ScriptableObject.h"
 #include "ScriptableContainer.h"
+#include "Bindings/ScriptableBindingSubsystem.h"
+#include "ScriptableTickScheduler.h"
 #include "ScriptablePropertyUtilities.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
@@ -110,6 +112,9 @@ void UScriptableObject::BakeAutoBindings()
 		}
 	}
 
+	// 4. Apply the resolve policies declared on the target properties
+	bChanged |= GetPropertyBindings().BakeResolvePolicies(this);
+
 	// Flag the object as modified so the serialization system knows it needs saving
 	if (bChanged)
 	{
@@ -308,12 +313,36 @@ void UScriptableObject::Unregister()
 	WorldPrivate = nullptr;
 	bRegistered = false;
 
+	// References point into the Context or siblings, which may not outlive the registration
+	PropertyBindings.ReleaseReferences(this);
+
 	ContextRef = nullptr;
 	BindingsMapRef = nullptr;
+	ContextVersionRef = nullptr;
 
 	OnUnregister();
 }
 
+void UScriptableObject::BeginStatelessUse(UObject* InOwner, const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, const FScriptableDataVersion* InContextVersion)
+{
+	ensureMsgf(!IsRegistered(), TEXT("BeginStatelessUse: (%s) is registered."), *GetPathName());
+
+	// GetWorld falls back to the owner's world while there is no registration
+	OwnerPrivate = InOwner;
+	InitRuntimeData(InContext, InBindingMap, InContextVersion);
+}
+
+void UScriptableObject::EndStatelessUse()
+{
+	// References point into the Context or siblings, same as on Unregister
+	PropertyBindings.ReleaseReferences(this);
+
+	ContextRef = nullptr;
+	BindingsMapRef = nullptr;
+	ContextVersionRef = nullptr;
+	OwnerPrivate = nullptr;
+}
+
 void UScriptableObject::RegisterObjectWithWorld(UWorld* InWorld)
 {
 	checkf(!IsUnreachable(), TEXT("%s"), *GetFullName());
@@ -412,28 +441,91 @@ bool UScriptableObject::SetupTickFunction(FTickFunction* TickFunction)
 
 void UScriptableObject::RegisterTickFunctions(bool bRegister)
 {
+	UScriptableTickSchedulerSubsystem* Scheduler = UWorld::GetSubsystem<UScriptableTickSchedulerSubsystem>(GetWorld());
+
 	if (bRegister)
 	{
-		if (SetupTickFunction(&PrimaryObjectTick))
+		bool bTicking = false;
+
+		// The scheduler ticks the objects of a world in batches, saving a tick function each
+		if (Scheduler && CanEverTick() && PrimaryObjectTick.bCanEverTick && !IsTemplate() && IsRegistered() && UScriptableTickSchedulerSubsystem::CanSchedule(PrimaryObjectTick))
+		{
+			if (!TickSlot.IsValid())
+			{
+				Scheduler->AddObject(this);
+			}
+			bTicking = true;
+		}
+		else if (SetupTickFunction(&PrimaryObjectTick))
 		{
 			PrimaryObjectTick.Target = this;
+			bTicking = true;
+		}
+
+		// Bindings that must stay fresh are resolved in a single batch per world, before this object ticks
+		if (bTicking && PropertyBindings.HasTickBindings())
+		{
+			if (UScriptableBindingSubsystem* BindingSubsystem = UWorld::GetSubsystem<UScriptableBindingSubsystem>(GetWorld()))
+			{
+				BindingSubsystem->AddTickBindings(this);
+			}
 		}
 	}
 	else
 	{
-		if (PrimaryObjectTick.IsTickFunctionRegistered())
+		bool bWasTicking = false;
+
+		if (TickSlot.IsValid())
+		{
+			if (Scheduler)
+			{
+				Scheduler->RemoveObject(this);
+			}
+			TickSlot = FScriptableTickSlot();
+			bWasTicking = true;
+		}
+		else if (PrimaryObjectTick.IsTickFunctionRegistered())
 		{
 			PrimaryObjectTick.UnRegisterTickFunction();
+			bWasTicking = true;
+		}
+
+		if (bWasTicking && PropertyBindings.HasTickBindings())
+		{
+			if (UScriptableBindingSubsystem* BindingSubsystem = UWorld::GetSubsystem<UScriptableBindingSubsystem>(GetWorld()))
+			{
+				BindingSubsystem->RemoveTickBindings(this);
+			}
+		}
+	}
+}
+
+void UScriptableObject::SetTickEnabled(bool bEnabled)
+{
+	// The tick function keeps the state of scheduled objects too, so it survives their next registration
+	PrimaryObjectTick.SetTickFunctionEnable(bEnabled);
+
+	if (TickSlot.IsValid())
+	{
+		if (UScriptableTickSchedulerSubsystem* Scheduler = UWorld::GetSubsystem<UScriptableTickSchedulerSubsystem>(GetWorld()))
+		{
+			Scheduler->SetObjectTickEnabled(this, bEnabled);
 		}
 	}
 }
 
+bool UScriptableObject::IsTickEnabled() const
+{
+	return PrimaryObjectTick.IsTickFunctionEnabled();
+}
+
 void FScriptableObjectTickFunction::ExecuteTick(float DeltaTime, enum ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FScriptableObjectTickFunction::ExecuteTick);
 	ExecuteTickHelper(Target, /*Target->bTickInEditor*/false, DeltaTime, TickType, [this, TickType](float DilatedTime)
 	{
 		Target->Tick(DilatedTime);
+		Target->MarkOutputsChanged();
 	});
 }
 
@@ -462,17 +554,48 @@ FName FScriptableObjectTickFunction::DiagnosticContext(bool bDetailed)
 //  Data Binding & Context
 // -------------------------------------------------------------------
 
-void UScriptableObject::InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap)
+void UScriptableObject::InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, const FScriptableDataVersion* InContextVersion)
 {
 	ContextRef = InContext;
 	BindingsMapRef = InBindingMap;
+	ContextVersionRef = InContextVersion;
+}
+
+void UScriptableObject::RegenerateBindingIDs(TConstArrayView<UScriptableObject*> Objects)
+{
+	TMap<FGuid, FGuid> NewIDs;
+	NewIDs.Reserve(Objects.Num());
+
+	for (UScriptableObject* Object : Objects)
+	{
+		const FGuid NewID = FGuid::NewGuid();
+		NewIDs.Add(Object->BindingID, NewID);
+		Object->BindingID = NewID;
+	}
+
+	for (UScriptableObject* Object : Objects)
+	{
+		for (FScriptablePropertyBinding& Binding : Object->PropertyBindings.Bindings)
+		{
+			Binding.TargetPath.SetStructID(Object->BindingID);
+
+			if (const FGuid* NewSourceID = NewIDs.Find(Binding.SourceID))
+			{
+				Binding.SourceID = *NewSourceID;
+				Binding.SourcePath.SetStructID(*NewSourceID);
+			}
+		}
+
+		// Compiled bindings cache their source object
+		Object->PropertyBindings.ResetCompiledBindings();
+	}
 }
 
 void UScriptableObject::PropagateRuntimeData(UScriptableObject* Child) const
 {
 	if (Child)
 	{
-		Child->InitRuntimeData(ContextRef, BindingsMapRef);
+		Child->InitRuntimeData(ContextRef, BindingsMapRef, ContextVersionRef);
 	}
 }
 
@@ -482,6 +605,23 @@ void UScriptableObject::ResolveBindings()
 	PropertyBindings.ResolveBindings(this);
 }
 
+void UScriptableObject::ResolveTickBindings()
+{
+	if (LastTickResolveFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastTickResolveFrame = GFrameCounter;
+
+	PreResolveBindings();
+	PropertyBindings.ResolveTickBindings(this);
+}
+
+void UScriptableObject::CompileBindings()
+{
+	PropertyBindings.CompileBindings(this);
+}
+
 UScriptableObject* UScriptableObject::FindBindingSource(const FGuid& InID)
 {
 	if (BindingsMapRef)
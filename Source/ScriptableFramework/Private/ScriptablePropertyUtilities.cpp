@@ -3,6 +3,7 @@
 #include "ScriptablePropertyUtilities.h"
 #include "ScriptableObject.h"
 #include "ScriptableContainer.h"
+#include "Bindings/ScriptablePropertyRef.h"
 #include "UObject/UnrealType.h"
 #include "UObject/EnumProperty.h"
 #include "StructUtils/PropertyBag.h"
@@ -17,6 +18,12 @@ bool FScriptablePropertyUtilities::ArePropertiesCompatible(const FProperty* Sour
 		return true;
 	}
 
+	// 1B. Read-only References (the target views the source memory instead of copying it)
+	if (FScriptablePropertyRef::IsRefProperty(TargetProp))
+	{
+		return FScriptablePropertyRef::CanReference(TargetProp, SourceProp);
+	}
+
 	// 2. Arrays (Recursive Check)
 	if (const FArrayProperty* SourceArray = CastField<FArrayProperty>(SourceProp))
 	{
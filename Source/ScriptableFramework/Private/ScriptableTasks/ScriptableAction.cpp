@@ -2,6 +2,8 @@
 
 #include "ScriptableTasks/ScriptableAction.h"
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableTaskPool.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
 
 FScriptableAction::FScriptableAction()
 {
@@ -22,15 +24,15 @@ FScriptableAction FScriptableAction::Clone(UObject* NewOuter) const
 	ClonedAction.OnActionBegin.Clear();
 	ClonedAction.OnActionFinish.Clear();
 
-	// 3. Deep copy the Tasks array to avoid mutating the Data Asset
+	// 3. Deep copy the Tasks array to avoid mutating the Data Asset. Task nodes were copied along with the struct.
 	ClonedAction.Tasks.Empty(Tasks.Num());
 
 	for (UScriptableTask* Task : Tasks)
 	{
 		if (Task)
 		{
-			// DuplicateObject creates a real memory copy with NewOuter as the owner
-			UScriptableTask* ClonedTask = DuplicateObject<UScriptableTask>(Task, NewOuter);
+			// A pooled instance reset to the task, or a real memory copy, with NewOuter as the owner
+			UScriptableTask* ClonedTask = UScriptableTaskPoolSubsystem::AcquireTask(Task, NewOuter);
 			ClonedAction.Tasks.Add(ClonedTask);
 		}
 	}
@@ -38,6 +40,18 @@ FScriptableAction FScriptableAction::Clone(UObject* NewOuter) const
 	return ClonedAction;
 }
 
+void FScriptableAction::ReleaseClone()
+{
+	Reset();
+
+	for (UScriptableTask* Task : Tasks)
+	{
+		UScriptableTaskPoolSubsystem::ReleaseTask(Task);
+	}
+
+	Tasks.Empty();
+}
+
 void FScriptableAction::Run(UObject* InOwner)
 {
 	if (!InOwner) return;
@@ -77,6 +91,22 @@ void FScriptableAction::Register(UObject* InOwner)
 			}
 		}
 	}
+
+	SortBindingSources();
+
+	// Nodes read the same Context as the tasks
+	FScriptableNodeContext NodeContext;
+	NodeContext.Owner = Owner;
+	GetChildContext(NodeContext.Context, NodeContext.ContextVersion);
+
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>();
+		if (Node && Node->IsEnabled())
+		{
+			Node->Register(Instance, NodeContext);
+		}
+	}
 }
 
 void FScriptableAction::Unregister()
@@ -89,6 +119,14 @@ void FScriptableAction::Unregister()
 		}
 	}
 
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->Unregister();
+		}
+	}
+
 	Super::Unregister();
 }
 
@@ -107,12 +145,20 @@ void FScriptableAction::Reset()
 		}
 	}
 
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->Reset();
+		}
+	}
+
 	Unregister();
 }
 
 void FScriptableAction::Begin()
 {
-	if (Tasks.IsEmpty())
+	if (IsEmpty())
 	{
 		Finish(true);
 		return;
@@ -123,13 +169,26 @@ void FScriptableAction::Begin()
 
 	if (Mode == EScriptableActionMode::Sequence)
 	{
-		BeginSubTask(Tasks[CurrentTaskIndex]);
+		BeginSubTaskAt(CurrentTaskIndex);
 	}
 	else if (Mode == EScriptableActionMode::Parallel)
 	{
-		for (UScriptableTask* Task : Tasks)
+		// Sources begin before the siblings reading their outputs.
+		// Copied first: a task finishing right away can finish and unregister the action, which empties the order.
+		TArray<UScriptableTask*, TInlineAllocator<16>> BeginOrder;
+		for (UScriptableObject* Source : GetBindingSourceOrder())
 		{
-			BeginSubTask(Task);
+			BeginOrder.Add(Cast<UScriptableTask>(Source));
+		}
+
+		for (int32 Index = 0; Index < BeginOrder.Num() && bIsRunning; ++Index)
+		{
+			BeginSubTask(BeginOrder[Index]);
+		}
+
+		for (int32 Index = 0; Index < TaskNodes.Num() && bIsRunning; ++Index)
+		{
+			BeginTaskNode(TaskNodes[Index]);
 		}
 	}
 
@@ -149,6 +208,15 @@ void FScriptableAction::Finish(bool bForce)
 		}
 	}
 
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->OnFinished.Unbind();
+			Node->Finish();
+		}
+	}
+
 	bIsRunning = false;
 	CurrentTaskIndex = 0;
 
@@ -176,12 +244,43 @@ void FScriptableAction::OnSubTaskFinished(UScriptableTask* Task)
 	}
 
 	// In Parallel mode CurrentTaskIndex acts as a counter
-	if (++CurrentTaskIndex >= Tasks.Num())
+	if (++CurrentTaskIndex >= Tasks.Num() + TaskNodes.Num())
 	{
 		Finish();
 	}
 	else if (Mode == EScriptableActionMode::Sequence)
 	{
-		BeginSubTask(Tasks[CurrentTaskIndex]);
+		BeginSubTaskAt(CurrentTaskIndex);
+	}
+}
+
+void FScriptableAction::BeginSubTaskAt(int32 Index)
+{
+	if (Index < Tasks.Num())
+	{
+		BeginSubTask(Tasks[Index]);
+	}
+	else
+	{
+		BeginTaskNode(TaskNodes[Index - Tasks.Num()]);
 	}
+}
+
+void FScriptableAction::BeginTaskNode(FInstancedStruct& Instance)
+{
+	FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>();
+	if (!Node || !Node->IsRegistered())
+	{
+		OnSubTaskFinished(nullptr);
+		return;
+	}
+
+	// Left bound once finished, the node may still be executing it
+	Node->OnFinished.BindRaw(this, &FScriptableAction::OnTaskNodeFinished);
+	Node->Begin();
+}
+
+void FScriptableAction::OnTaskNodeFinished()
+{
+	OnSubTaskFinished(nullptr);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "ScriptableTasks/ScriptableActionAsset.h"
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableTaskPool.h"
 
 #include "Algo/AnyOf.h"
 
@@ -33,7 +34,7 @@ void UScriptableTask_RunAsset::ResetTask()
 
 void UScriptableTask_RunAsset::BeginTask()
 {
-	if (Asset && !RuntimeAction.Tasks.IsEmpty())
+	if (Asset && !RuntimeAction.IsEmpty())
 	{
 		RuntimeAction.Begin();
 	}
@@ -64,14 +65,15 @@ void UScriptableTask_RunAsset::InstantiateRuntimeAction()
 			RuntimeAction.Context = *ParentContext;
 		}
 
-		// Deep Copy Tasks
+		// Instance Tasks
 		// The 'Tasks' array currently points to the Asset's archetype objects.
+		// Instances come from the task pool, so re-running the asset doesn't duplicate them again.
 		for (int32 i = 0; i < RuntimeAction.Tasks.Num(); ++i)
 		{
 			UScriptableTask* TemplateTask = RuntimeAction.Tasks[i];
 			if (TemplateTask)
 			{
-				UScriptableTask* NewTaskInstance = DuplicateObject<UScriptableTask>(TemplateTask, this);
+				UScriptableTask* NewTaskInstance = UScriptableTaskPoolSubsystem::AcquireTask(TemplateTask, this);
 				RuntimeAction.Tasks[i] = NewTaskInstance;
 			}
 		}
@@ -89,7 +91,12 @@ void UScriptableTask_RunAsset::TeardownRuntimeAction()
 
 	RuntimeAction.Unregister();
 
-	// Explicitly empty tasks to drop references to the instanced objects
+	// Give the instances back to the pool, then drop our references to them
+	for (UScriptableTask* Task : RuntimeAction.Tasks)
+	{
+		UScriptableTaskPoolSubsystem::ReleaseTask(Task);
+	}
+
 	RuntimeAction.Tasks.Empty();
 }
 
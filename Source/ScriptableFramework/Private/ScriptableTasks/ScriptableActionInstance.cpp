@@ -0,0 +1,608 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTasks/ScriptableActionInstance.h"
+#include "ScriptableTasks/ScriptableActionAsset.h"
+#include "ScriptableTasks/ScriptableTaskPool.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
+#include "ScriptableTasks/ScriptableTask_Flow.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+
+#include "Algo/AnyOf.h"
+
+// -------------------------------------------------------------------
+//  FScriptableTaskInstanceContext
+// -------------------------------------------------------------------
+
+FStructView FScriptableTaskInstanceContext::GetInstanceData() const
+{
+	const int32 DataIndex = Run->TaskStates[TaskIndex].InstanceDataIndex;
+	return DataIndex != INDEX_NONE ? Run->InstanceData[DataIndex] : FStructView();
+}
+
+UObject* FScriptableTaskInstanceContext::GetOwner() const
+{
+	return Run->Owner;
+}
+
+UWorld* FScriptableTaskInstanceContext::GetWorld() const
+{
+	return Run->Owner ? Run->Owner->GetWorld() : nullptr;
+}
+
+const FInstancedPropertyBag& FScriptableTaskInstanceContext::GetContext() const
+{
+	return Run->Context;
+}
+
+void FScriptableTaskInstanceContext::Finish() const
+{
+	Run->FinishSharedTask(TaskIndex);
+}
+
+// -------------------------------------------------------------------
+//  FScriptableActionInstance
+// -------------------------------------------------------------------
+
+void FScriptableActionInstance::Init(UScriptableActionAsset* InAsset)
+{
+	if (InAsset && InAsset == Asset && GetNumSubTasks() > 0)
+	{
+		Finish();
+		return;
+	}
+
+	Release();
+
+	Asset = InAsset;
+	if (!Asset)
+	{
+		return;
+	}
+
+	const FScriptableAction& Action = Asset->Action;
+
+	ContextDefinitions = Action.ContextDefinitions;
+	Context = Action.Context;
+	if (!Context.IsValid())
+	{
+		ConstructContext();
+	}
+
+	TaskStates.SetNum(Action.Tasks.Num());
+	TaskCopies.SetNum(Action.Tasks.Num());
+
+	// Lay out the instance data of every shared task in a single buffer
+	TArray<FConstStructView, TInlineAllocator<16>> DataTypes;
+
+	for (int32 Index = 0; Index < Action.Tasks.Num(); ++Index)
+	{
+		const UScriptableTask* Task = Action.Tasks[Index];
+		FScriptableInstanceTaskState& State = TaskStates[Index];
+
+		State.bShared = Task && CanShareTask(Action, Task);
+		if (State.bShared)
+		{
+			if (const UScriptStruct* DataType = Task->GetInstanceDataType())
+			{
+				State.InstanceDataIndex = DataTypes.Add(FConstStructView(DataType));
+			}
+		}
+	}
+
+	InstanceData.Append(DataTypes);
+
+	TaskNodes = Action.TaskNodes;
+}
+
+FScriptableActionInstance::~FScriptableActionInstance()
+{
+	checkf(!bIsRunning, TEXT("FScriptableActionInstance of %s destroyed while running, finish or release it first."), *GetNameSafe(Asset));
+}
+
+void FScriptableActionInstance::CheckAddress() const
+{
+	checkf(!bIsRunning || RunAddress == this, TEXT("FScriptableActionInstance of %s was relocated while running, its timers and task delegates point to the old address."), *GetNameSafe(Asset));
+}
+
+void FScriptableActionInstance::Run(UObject* InOwner)
+{
+	if (!InOwner || !Asset) return;
+
+	if (IsRunning())
+	{
+		Finish();
+	}
+
+	Register(InOwner);
+
+	bIsRunning = true;
+	RunAddress = this;
+	CurrentTaskIndex = 0;
+
+	if (GetNumSubTasks() == 0)
+	{
+		Finish();
+		return;
+	}
+
+	if (Asset->Action.Mode == EScriptableActionMode::Sequence)
+	{
+		BeginSubTask(CurrentTaskIndex);
+	}
+	else if (Asset->Action.Mode == EScriptableActionMode::Parallel)
+	{
+		// Sources begin before the siblings reading their outputs. Shared tasks have no bindings, so they go last.
+		// Resolved to indices first: a task finishing right away can finish and unregister the run, which empties the order.
+		TArray<int32, TInlineAllocator<16>> BeginOrder;
+		for (UScriptableObject* Source : GetBindingSourceOrder())
+		{
+			const int32 Index = TaskCopies.IndexOfByKey(Cast<UScriptableTask>(Source));
+			if (Index != INDEX_NONE)
+			{
+				BeginOrder.Add(Index);
+			}
+		}
+
+		for (int32 OrderIndex = 0; OrderIndex < BeginOrder.Num() && bIsRunning; ++OrderIndex)
+		{
+			BeginSubTask(BeginOrder[OrderIndex]);
+		}
+
+		for (int32 Index = 0; Index < TaskCopies.Num() && bIsRunning; ++Index)
+		{
+			if (!TaskCopies[Index])
+			{
+				BeginSubTask(Index);
+			}
+		}
+
+		for (int32 Index = TaskStates.Num(); Index < GetNumSubTasks() && bIsRunning; ++Index)
+		{
+			BeginSubTask(Index);
+		}
+	}
+
+	OnActionBegin.Broadcast();
+}
+
+void FScriptableActionInstance::Finish()
+{
+	if (!bIsRunning) return;
+
+	CheckAddress();
+
+	for (int32 Index = 0; Index < TaskStates.Num(); ++Index)
+	{
+		if (UScriptableTask* Copy = TaskCopies[Index])
+		{
+			Copy->OnTaskFinishNative.RemoveAll(this);
+			Copy->Finish();
+		}
+		else if (TaskStates[Index].Status == EScriptableTaskStatus::Begun)
+		{
+			TaskStates[Index].Status = EScriptableTaskStatus::Finished;
+			UScriptableTimerSubsystem::ClearTimerFor(Owner, TaskStates[Index].LoopDelayHandle);
+
+			if (const UScriptableTask* Task = GetAssetTask(Index))
+			{
+				Task->FinishShared(FScriptableTaskInstanceContext(*this, Index));
+			}
+		}
+	}
+
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->OnFinished.Unbind();
+			Node->Finish();
+		}
+	}
+
+	bIsRunning = false;
+	RunAddress = nullptr;
+	CurrentTaskIndex = 0;
+
+	OnActionFinish.Broadcast();
+}
+
+void FScriptableActionInstance::Reset()
+{
+	Finish();
+
+	for (int32 Index = 0; Index < TaskStates.Num(); ++Index)
+	{
+		if (UScriptableTask* Copy = TaskCopies[Index])
+		{
+			Copy->Reset();
+		}
+
+		FScriptableInstanceTaskState& State = TaskStates[Index];
+		State.Status = EScriptableTaskStatus::None;
+		State.LoopIndex = 0;
+		State.bDoOnceFinished = false;
+	}
+
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->Reset();
+		}
+	}
+
+	Unregister();
+}
+
+void FScriptableActionInstance::Release()
+{
+	Finish();
+	Unregister();
+
+	for (UScriptableTask* Copy : TaskCopies)
+	{
+		UScriptableTaskPoolSubsystem::ReleaseTask(Copy);
+	}
+
+	TaskCopies.Empty();
+	TaskStates.Empty();
+	InstanceData.Empty();
+	TaskNodes.Empty();
+	ResetContext();
+
+	Asset = nullptr;
+}
+
+int32 FScriptableActionInstance::GetNumSharedTasks() const
+{
+	int32 NumShared = 0;
+	for (const FScriptableInstanceTaskState& State : TaskStates)
+	{
+		NumShared += State.bShared;
+	}
+	return NumShared;
+}
+
+int32 FScriptableActionInstance::GetInstanceDataSize() const
+{
+	int32 Size = 0;
+	for (int32 Index = 0; Index < InstanceData.Num(); ++Index)
+	{
+		Size += InstanceData[Index].GetScriptStruct()->GetStructureSize();
+	}
+	return Size;
+}
+
+const UScriptableTask* FScriptableActionInstance::GetAssetTask(int32 Index) const
+{
+	return Asset && Asset->Action.Tasks.IsValidIndex(Index) ? Asset->Action.Tasks[Index].Get() : nullptr;
+}
+
+bool FScriptableActionInstance::CanShareTask(const FScriptableAction& Action, const UScriptableTask* Task)
+{
+	// Bound values would be written to the asset
+	if (!Task->SupportsSharedExecution() || !Task->GetPropertyBindings().Bindings.IsEmpty())
+	{
+		return false;
+	}
+
+	// Siblings reading the outputs of the task need an object to read them from
+	const FGuid TaskID = Task->GetBindingID();
+	for (const UScriptableTask* Other : Action.Tasks)
+	{
+		if (Other && Other != Task && Algo::AnyOf(Other->GetPropertyBindings().Bindings, [&TaskID](const FScriptablePropertyBinding& Binding) { return Binding.SourceID == TaskID; }))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FScriptableActionInstance::Register(UObject* InOwner)
+{
+	if (bRegistered)
+	{
+		if (Owner == InOwner)
+		{
+			return;
+		}
+
+		Unregister();
+	}
+
+	Super::Register(InOwner);
+
+	for (int32 Index = 0; Index < TaskStates.Num(); ++Index)
+	{
+		const UScriptableTask* Task = GetAssetTask(Index);
+		if (!Task || TaskStates[Index].bShared)
+		{
+			continue;
+		}
+
+		if (!TaskCopies[Index])
+		{
+			TaskCopies[Index] = UScriptableTaskPoolSubsystem::AcquireTask(Task, InOwner);
+		}
+
+		UScriptableTask* Copy = TaskCopies[Index];
+
+		// Add to local map and inject THIS Context into the task
+		AddBindingSource(Copy);
+
+		if (Copy->IsEnabled())
+		{
+			Copy->Register(InOwner);
+		}
+	}
+
+	SortBindingSources();
+
+	FScriptableNodeContext NodeContext;
+	NodeContext.Owner = Owner;
+	GetChildContext(NodeContext.Context, NodeContext.ContextVersion);
+
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>();
+		if (Node && Node->IsEnabled())
+		{
+			Node->Register(Instance, NodeContext);
+		}
+	}
+
+	bRegistered = true;
+}
+
+void FScriptableActionInstance::Unregister()
+{
+	if (!bRegistered)
+	{
+		return;
+	}
+
+	for (UScriptableTask* Copy : TaskCopies)
+	{
+		if (Copy && Copy->IsRegistered())
+		{
+			Copy->Unregister();
+		}
+	}
+
+	for (FInstancedStruct& Instance : TaskNodes)
+	{
+		if (FScriptableTaskNode* Node = Instance.GetMutablePtr<FScriptableTaskNode>())
+		{
+			Node->Unregister();
+		}
+	}
+
+	Super::Unregister();
+	bRegistered = false;
+}
+
+void FScriptableActionInstance::BeginSubTask(int32 Index)
+{
+	if (Index >= TaskStates.Num())
+	{
+		FScriptableTaskNode* Node = TaskNodes[Index - TaskStates.Num()].GetMutablePtr<FScriptableTaskNode>();
+		if (!Node || !Node->IsRegistered())
+		{
+			OnSubTaskFinished();
+			return;
+		}
+
+		// Left bound once finished, the node may still be executing it
+		Node->OnFinished.BindRaw(this, &FScriptableActionInstance::OnTaskNodeFinished);
+		Node->Begin();
+		return;
+	}
+
+	if (UScriptableTask* Copy = TaskCopies[Index])
+	{
+		if (!Copy->IsEnabled())
+		{
+			OnSubTaskFinished();
+			return;
+		}
+
+		Copy->OnTaskFinishNative.RemoveAll(this);
+		Copy->OnTaskFinishNative.AddRaw(this, &FScriptableActionInstance::OnTaskCopyFinished, Index);
+		Copy->Begin();
+		return;
+	}
+
+	const UScriptableTask* Task = GetAssetTask(Index);
+	FScriptableInstanceTaskState& State = TaskStates[Index];
+
+	// Same as UScriptableTask::Begin, a Once task that already ran counts as finished
+	if (!Task || !State.bShared || !Task->IsEnabled() || (Task->GetControl().bDoOnce && State.bDoOnceFinished))
+	{
+		OnSubTaskFinished();
+		return;
+	}
+
+	check(State.Status != EScriptableTaskStatus::Begun);
+
+	State.Status = EScriptableTaskStatus::Begun;
+	State.LoopIndex = 0;
+
+	// Every run starts from default instance data
+	if (State.InstanceDataIndex != INDEX_NONE)
+	{
+		const FStructView Data = InstanceData[State.InstanceDataIndex];
+		Data.GetScriptStruct()->ClearScriptStruct(Data.GetMemory());
+	}
+
+	Task->BeginShared(FScriptableTaskInstanceContext(*this, Index));
+}
+
+void FScriptableActionInstance::FinishSharedTask(int32 Index)
+{
+	const UScriptableTask* Task = GetAssetTask(Index);
+	FScriptableInstanceTaskState& State = TaskStates[Index];
+
+	if (!Task || State.Status != EScriptableTaskStatus::Begun)
+	{
+		return;
+	}
+
+	const FScriptableTaskInstanceContext TaskContext(*this, Index);
+	const FScriptableTaskControl& Control = Task->GetControl();
+
+	// Same as UScriptableTask::Finish, finishing a task that waits for its loop delay ends the loop
+	const bool bWasWaitingToLoop = State.LoopDelayHandle.IsValid();
+	UScriptableTimerSubsystem::ClearTimerFor(Owner, State.LoopDelayHandle);
+
+	if (Control.bLoop && !bWasWaitingToLoop)
+	{
+		State.LoopIndex++;
+
+		// 0 means Infinite, otherwise check strictly against count
+		if (Control.LoopCount <= 0 || State.LoopIndex < Control.LoopCount)
+		{
+			if (Control.LoopDelay > 0.0f)
+			{
+				State.LoopDelayHandle = UScriptableTimerSubsystem::SetTimerFor(Owner, Control.LoopDelay, &FScriptableActionInstance::OnSharedLoopDelayTimer, this, Index);
+			}
+
+			if (!State.LoopDelayHandle.IsValid())
+			{
+				Task->BeginShared(TaskContext);
+			}
+			return;
+		}
+	}
+
+	if (Control.bDoOnce)
+	{
+		State.bDoOnceFinished = true;
+	}
+
+	State.Status = EScriptableTaskStatus::Finished;
+	Task->FinishShared(TaskContext);
+
+	OnSubTaskFinished();
+}
+
+void FScriptableActionInstance::OnSharedLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+	FScriptableActionInstance& Run = *static_cast<FScriptableActionInstance*>(Payload);
+	FScriptableInstanceTaskState& State = Run.TaskStates[PayloadIndex];
+	State.LoopDelayHandle.Invalidate();
+
+	const UScriptableTask* Task = Run.GetAssetTask(PayloadIndex);
+	if (Task && State.Status == EScriptableTaskStatus::Begun)
+	{
+		Task->BeginShared(FScriptableTaskInstanceContext(Run, PayloadIndex));
+	}
+}
+
+void FScriptableActionInstance::OnTaskCopyFinished(UScriptableTask* Task, int32 Index)
+{
+	if (Task)
+	{
+		Task->OnTaskFinishNative.RemoveAll(this);
+	}
+
+	OnSubTaskFinished();
+}
+
+void FScriptableActionInstance::OnTaskNodeFinished()
+{
+	OnSubTaskFinished();
+}
+
+void FScriptableActionInstance::OnSubTaskFinished()
+{
+	// In Parallel mode CurrentTaskIndex acts as a counter
+	if (++CurrentTaskIndex >= GetNumSubTasks())
+	{
+		Finish();
+	}
+	else if (Asset->Action.Mode == EScriptableActionMode::Sequence)
+	{
+		BeginSubTask(CurrentTaskIndex);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+/**
+ * Benchmark of starting many runs of the same action asset, copying its tasks (FScriptableAction::Clone) against sharing them.
+ * The asset holds a sequence of NumTasks Wait tasks. Reports the time to start every run and the number of objects created.
+ * Usage: Scriptable.Bench.SharedActions [NumRuns] [NumTasks]
+ */
+static void BenchmarkSharedActions(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 NumRuns = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+	const int32 NumTasks = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+	UObject* Owner = World ? World->GetWorldSettings() : nullptr;
+	if (!Owner)
+	{
+		UE_LOG(LogScriptableTask, Warning, TEXT("Scriptable.Bench.SharedActions: requires a world."));
+		return;
+	}
+
+	UScriptableActionAsset* Asset = NewObject<UScriptableActionAsset>(GetTransientPackage());
+	Asset->Action.Mode = EScriptableActionMode::Sequence;
+	for (int32 Index = 0; Index < NumTasks; ++Index)
+	{
+		UScriptableTask_Wait* Wait = NewObject<UScriptableTask_Wait>(Asset);
+		Wait->Duration = 1000.0f;
+		Asset->Action.Tasks.Add(Wait);
+	}
+
+	// Clones are bound to by address, nothing may move once started
+	TArray<FScriptableAction> Clones;
+	Clones.Reserve(NumRuns);
+
+	int32 StartObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Run = 0; Run < NumRuns; ++Run)
+	{
+		Clones.Add_GetRef(Asset->Action.Clone(Owner)).Run(Owner);
+	}
+	const double CloneMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	const int32 CloneObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - StartObjects;
+
+	TArray<FScriptableActionInstance> Instances;
+	Instances.SetNum(NumRuns);
+
+	StartObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	StartCycles = FPlatformTime::Cycles64();
+	for (FScriptableActionInstance& Instance : Instances)
+	{
+		Instance.Init(Asset);
+		Instance.Run(Owner);
+	}
+	const double SharedMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+	const int32 SharedObjects = GUObjectArray.GetObjectArrayNumMinusAvailable() - StartObjects;
+
+	UE_LOG(LogScriptableTask, Display, TEXT("Scriptable.Bench.SharedActions (%d runs of %d tasks): copied %.3f ms, %d objects created; shared %.3f ms, %d objects created, %d bytes of instance data per run. Speedup x%.2f"),
+		NumRuns, NumTasks,
+		CloneMs, CloneObjects,
+		SharedMs, SharedObjects, Instances[0].GetInstanceDataSize(),
+		SharedMs > 0.0 ? CloneMs / SharedMs : 0.0);
+
+	for (FScriptableAction& Clone : Clones)
+	{
+		Clone.ReleaseClone();
+	}
+
+	for (FScriptableActionInstance& Instance : Instances)
+	{
+		Instance.Release();
+	}
+
+	Asset->MarkAsGarbage();
+}
+
+static FAutoConsoleCommand BenchmarkSharedActionsCommand(
+	TEXT("Scriptable.Bench.SharedActions"),
+	TEXT("Compares starting many runs of an action asset with copied tasks against shared tasks. Usage: Scriptable.Bench.SharedActions [NumRuns] [NumTasks]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkSharedActions));
+#endif
@@ -1,6 +1,7 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableActionInstance.h"
 
 DEFINE_LOG_CATEGORY(LogScriptableTask);
 
@@ -12,6 +13,50 @@ void UScriptableTask::OnUnregister()
 	OnTaskFinishNative.Clear();
 	OnTaskBegin.Clear();
 	OnTaskFinish.Clear();
+
+	// A pending restart would begin the next run of a pooled instance
+	UScriptableTimerSubsystem::ClearTimerFor(this, LoopDelayHandle);
+}
+
+bool UScriptableTask::ResetToTemplate(const UScriptableTask* Template)
+{
+	check(Template && Template->GetClass() == GetClass());
+	check(!IsRegistered());
+
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		if (!It->HasAnyPropertyFlags(CPF_Transient) && It->ContainsInstancedObjectProperty())
+		{
+			return false;
+		}
+	}
+
+	for (TFieldIterator<FProperty> It(GetClass()); It; ++It)
+	{
+		const FProperty* Prop = *It;
+
+		// Bindings, ids and tick settings never change at runtime and are already the template's.
+		// Transient instanced properties are runtime state the task clears on unregister.
+		if (Prop->GetOwnerClass() == UScriptableObject::StaticClass() || Prop->ContainsInstancedObjectProperty())
+		{
+			continue;
+		}
+
+		Prop->CopyCompleteValue_InContainer(this, Template);
+	}
+
+	// Compiled plans remember the versions they last copied, and would skip copying unchanged sources into the restored properties
+	PropertyBindings.ResetCompiledBindings();
+
+	bEnabled = Template->bEnabled;
+	Status = EScriptableTaskStatus::None;
+	CurrentLoopIndex = 0;
+	bDoOnceFinished = false;
+
+	OnTaskBeginNative.Clear();
+	OnTaskFinishNative.Clear();
+
+	return true;
 }
 
 void UScriptableTask::Reset()
@@ -47,6 +92,7 @@ void UScriptableTask::Begin()
 	Status = EScriptableTaskStatus::Begun;
 	RegisterTickFunctions(true);
 	BeginTask();
+	MarkOutputsChanged();
 
 	OnTaskBeginNative.Broadcast(this);
 	OnTaskBegin.Broadcast(this);
@@ -56,17 +102,30 @@ void UScriptableTask::Finish()
 {
 	if (HasBegun() && !HasFinished() && IsEnabled())
 	{
-		if (Control.bLoop)
+		// Finishing a task that waits for its loop delay ends the loop
+		const bool bWasWaitingToLoop = IsWaitingToLoop();
+		UScriptableTimerSubsystem::ClearTimerFor(this, LoopDelayHandle);
+
+		if (Control.bLoop && !bWasWaitingToLoop)
 		{
 			CurrentLoopIndex++;
 
 			// 0 means Infinite, otherwise check strictly against count
 			if (Control.LoopCount <= 0 || CurrentLoopIndex < Control.LoopCount)
 			{
+				if (Control.LoopDelay > 0.0f)
+				{
+					LoopDelayHandle = UScriptableTimerSubsystem::SetTimerFor(this, Control.LoopDelay, &UScriptableTask::OnLoopDelayTimer);
+				}
+
 				// Restart the task logic without changing Status or broadcasting Finish.
 				// Note: We don't call Begin() to avoid resetting CurrentLoopIndex.
 				// We call the virtual implementation directly.
-				BeginTask();
+				if (!IsWaitingToLoop())
+				{
+					BeginTask();
+					MarkOutputsChanged();
+				}
 				return; // Task is NOT finished yet.
 			}
 		}
@@ -80,12 +139,25 @@ void UScriptableTask::Finish()
 		Status = EScriptableTaskStatus::Finished;
 		RegisterTickFunctions(false);
 		FinishTask();
+		MarkOutputsChanged();
 
 		OnTaskFinishNative.Broadcast(this);
 		OnTaskFinish.Broadcast(this);
 	}
 }
 
+void UScriptableTask::OnLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+	UScriptableTask* Task = static_cast<UScriptableTask*>(Target);
+	Task->LoopDelayHandle.Invalidate();
+
+	if (Task->HasBegun())
+	{
+		Task->BeginTask();
+		Task->MarkOutputsChanged();
+	}
+}
+
 void UScriptableTask::ResetTask()
 {
 	ReceiveResetTask();
@@ -99,4 +171,9 @@ void UScriptableTask::BeginTask()
 void UScriptableTask::FinishTask()
 {
 	ReceiveFinishTask();
+}
+
+void UScriptableTask::BeginShared(const FScriptableTaskInstanceContext& Context) const
+{
+	Context.Finish();
 }
\ No newline at end of file
@@ -0,0 +1,114 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTasks/ScriptableTaskNode.h"
+
+FScriptableTaskNode::FScriptableTaskNode(const FScriptableTaskNode& Other)
+	: FScriptableNode(Other)
+	, Control(Other.Control)
+{
+}
+
+FScriptableTaskNode& FScriptableTaskNode::operator=(const FScriptableTaskNode& Other)
+{
+	FScriptableNode::operator=(Other);
+	Control = Other.Control;
+	return *this;
+}
+
+void FScriptableTaskNode::Begin()
+{
+	check(IsRegistered());
+
+	if (Control.bDoOnce && bDoOnceFinished)
+	{
+		// Same as the tasks: it counts as begun and finished, so the action proceeds to the next one
+		OnFinished.ExecuteIfBound();
+		return;
+	}
+
+	check(Status != EScriptableTaskStatus::Begun);
+
+	CurrentLoopIndex = 0;
+
+	ResolveBindings();
+
+	Status = EScriptableTaskStatus::Begun;
+	BeginTask();
+}
+
+void FScriptableTaskNode::Finish()
+{
+	if (!HasBegun() || !IsEnabled())
+	{
+		return;
+	}
+
+	// Same as the tasks: finishing a node that waits for its loop delay ends the loop
+	const bool bWasWaitingToLoop = IsWaitingToLoop();
+	UScriptableTimerSubsystem::ClearTimerFor(GetOwner(), LoopDelayHandle);
+
+	if (Control.bLoop && !bWasWaitingToLoop)
+	{
+		CurrentLoopIndex++;
+
+		// 0 means Infinite, otherwise check strictly against count
+		if (Control.LoopCount <= 0 || CurrentLoopIndex < Control.LoopCount)
+		{
+			if (Control.LoopDelay > 0.0f)
+			{
+				LoopDelayHandle = UScriptableTimerSubsystem::SetTimerFor(GetOwner(), Control.LoopDelay, &FScriptableTaskNode::OnLoopDelayTimer, this);
+			}
+
+			if (!IsWaitingToLoop())
+			{
+				BeginTask();
+			}
+			return;
+		}
+	}
+
+	if (Control.bDoOnce)
+	{
+		bDoOnceFinished = true;
+	}
+
+	Status = EScriptableTaskStatus::Finished;
+	FinishTask();
+
+	OnFinished.ExecuteIfBound();
+}
+
+void FScriptableTaskNode::OnUnregister()
+{
+	FScriptableNode::OnUnregister();
+
+	UScriptableTimerSubsystem::ClearTimerFor(GetOwner(), LoopDelayHandle);
+}
+
+void FScriptableTaskNode::OnLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+	FScriptableTaskNode* Node = static_cast<FScriptableTaskNode*>(Payload);
+	Node->LoopDelayHandle.Invalidate();
+
+	if (Node->HasBegun())
+	{
+		Node->BeginTask();
+	}
+}
+
+void FScriptableTaskNode::Reset()
+{
+	if (HasFinished())
+	{
+		Status = EScriptableTaskStatus::None;
+		CurrentLoopIndex = 0;
+		bDoOnceFinished = false;
+		ResetTask();
+	}
+}
+
+void FScriptableTaskNode_LogMessage::BeginTask()
+{
+	ScriptableDebug::PrintMessage(Message, Severity, bPrintToScreen, bPrintToLog, Duration, TextColor);
+	Finish();
+}
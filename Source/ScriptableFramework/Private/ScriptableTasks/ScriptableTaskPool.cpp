@@ -0,0 +1,177 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTasks/ScriptableTaskPool.h"
+#include "ScriptableTasks/ScriptableTask.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static bool GScriptableTaskPoolEnabled = true;
+static FAutoConsoleVariableRef CVarScriptableTaskPoolEnabled(
+	TEXT("Scriptable.TaskPool.Enabled"),
+	GScriptableTaskPoolEnabled,
+	TEXT("If true, cloned actions and Run Asset tasks reuse pooled task instances instead of duplicating their templates on every run."));
+
+static int32 GScriptableTaskPoolMaxPerTemplate = 32;
+static FAutoConsoleVariableRef CVarScriptableTaskPoolMaxPerTemplate(
+	TEXT("Scriptable.TaskPool.MaxPerTemplate"),
+	GScriptableTaskPoolMaxPerTemplate,
+	TEXT("Maximum number of free instances kept per template task. Instances released beyond it are left to the garbage collector."));
+
+void UScriptableTaskPoolSubsystem::Deinitialize()
+{
+	Empty();
+	Super::Deinitialize();
+}
+
+void UScriptableTaskPoolSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	for (TPair<TObjectKey<UScriptableTask>, FScriptableTaskPoolBucket>& Pair : CastChecked<UScriptableTaskPoolSubsystem>(InThis)->Buckets)
+	{
+		Collector.AddReferencedObjects(Pair.Value.Instances, InThis);
+	}
+}
+
+UScriptableTask* UScriptableTaskPoolSubsystem::Acquire(const UScriptableTask* Template)
+{
+	check(Template);
+
+	if (FScriptableTaskPoolBucket* Bucket = Buckets.Find(TObjectKey<UScriptableTask>(Template)))
+	{
+		while (!Bucket->Instances.IsEmpty())
+		{
+			UScriptableTask* Instance = Bucket->Instances.Pop(EAllowShrinking::No);
+			--Stats.NumPooled;
+
+			if (IsValid(Instance))
+			{
+				++Stats.Hits;
+				return Instance;
+			}
+		}
+	}
+
+	// Pooled instances live under the pool for good, moving them to each user would rename them on every run
+	UScriptableTask* Instance = DuplicateObject<UScriptableTask>(Template, this);
+	Instance->PoolTemplate = Template;
+	++Stats.Misses;
+	return Instance;
+}
+
+void UScriptableTaskPoolSubsystem::Release(UScriptableTask* Instance)
+{
+	if (!IsValid(Instance))
+	{
+		return;
+	}
+
+	if (!ensureMsgf(!Instance->IsRegistered(), TEXT("Release: (%s) is still registered."), *Instance->GetPathName()))
+	{
+		return;
+	}
+
+	const UScriptableTask* Template = Instance->PoolTemplate.Get();
+	if (!Template || Template->GetClass() != Instance->GetClass())
+	{
+		Instance->PoolTemplate.Reset();
+		++Stats.Discards;
+		return;
+	}
+
+	FScriptableTaskPoolBucket* Bucket = Buckets.Find(TObjectKey<UScriptableTask>(Template));
+	if (!Bucket)
+	{
+		// New templates are rare, a good time to drop the buckets of templates that are gone
+		PruneBuckets();
+		Bucket = &Buckets.Add(TObjectKey<UScriptableTask>(Template));
+	}
+
+	if (Bucket->Instances.Num() >= GScriptableTaskPoolMaxPerTemplate || Bucket->Instances.Contains(Instance))
+	{
+		++Stats.Discards;
+		return;
+	}
+
+	// Resetting now rather than on acquire drops what the instance references while it waits
+	if (!Instance->ResetToTemplate(Template))
+	{
+		Instance->PoolTemplate.Reset();
+		++Stats.Discards;
+		return;
+	}
+
+	Bucket->Instances.Add(Instance);
+
+	++Stats.NumPooled;
+	++Stats.Releases;
+}
+
+void UScriptableTaskPoolSubsystem::Empty()
+{
+	Buckets.Empty();
+	Stats.NumPooled = 0;
+}
+
+void UScriptableTaskPoolSubsystem::PruneBuckets()
+{
+	for (auto It = Buckets.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.ResolveObjectPtr())
+		{
+			Stats.NumPooled -= It->Value.Instances.Num();
+			Stats.Discards += It->Value.Instances.Num();
+			It.RemoveCurrent();
+		}
+	}
+}
+
+UScriptableTask* UScriptableTaskPoolSubsystem::AcquireTask(const UScriptableTask* Template, UObject* Outer)
+{
+	if (GScriptableTaskPoolEnabled && Outer)
+	{
+		if (UScriptableTaskPoolSubsystem* Pool = UWorld::GetSubsystem<UScriptableTaskPoolSubsystem>(Outer->GetWorld()))
+		{
+			return Pool->Acquire(Template);
+		}
+	}
+
+	return DuplicateObject<UScriptableTask>(Template, Outer);
+}
+
+void UScriptableTaskPoolSubsystem::ReleaseTask(UScriptableTask* Instance)
+{
+	if (!GScriptableTaskPoolEnabled || !Instance || !Instance->PoolTemplate.IsValid())
+	{
+		return;
+	}
+
+	if (UScriptableTaskPoolSubsystem* Pool = Cast<UScriptableTaskPoolSubsystem>(Instance->GetOuter()))
+	{
+		Pool->Release(Instance);
+	}
+}
+
+static void DumpTaskPoolStats(UWorld* World)
+{
+	const UScriptableTaskPoolSubsystem* Pool = UWorld::GetSubsystem<UScriptableTaskPoolSubsystem>(World);
+	if (!Pool)
+	{
+		UE_LOG(LogScriptableTask, Display, TEXT("Scriptable.TaskPool.Stats: no task pool in this world."));
+		return;
+	}
+
+	const FScriptableTaskPoolStats& Stats = Pool->GetStats();
+	const uint64 Acquisitions = Stats.Hits + Stats.Misses;
+
+	UE_LOG(LogScriptableTask, Display, TEXT("Scriptable.TaskPool.Stats (%s): %llu hits, %llu misses (%.1f%% hit rate), %llu releases, %llu discards, %d instances pooled"),
+		*World->GetName(),
+		Stats.Hits, Stats.Misses,
+		Acquisitions > 0 ? 100.0 * Stats.Hits / Acquisitions : 0.0,
+		Stats.Releases, Stats.Discards, Stats.NumPooled);
+}
+
+static FAutoConsoleCommand DumpTaskPoolStatsCommand(
+	TEXT("Scriptable.TaskPool.Stats"),
+	TEXT("Logs the hits, misses and size of the task pool of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&DumpTaskPoolStats));
@@ -1,12 +1,30 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableTasks/ScriptableTask_Debug.h"
+#include "ScriptableTasks/ScriptableActionInstance.h"
 #include "Engine/Engine.h"
 
 // Define a static log category for the framework logic
 DEFINE_LOG_CATEGORY_STATIC(LogScriptableLogic, Log, All);
 
 void UScriptableTask_LogMessage::BeginTask()
+{
+	PrintMessage();
+	Finish();
+}
+
+void UScriptableTask_LogMessage::BeginShared(const FScriptableTaskInstanceContext& Context) const
+{
+	PrintMessage();
+	Context.Finish();
+}
+
+void UScriptableTask_LogMessage::PrintMessage() const
+{
+	ScriptableDebug::PrintMessage(Message, Severity, bPrintToScreen, bPrintToLog, Duration, TextColor);
+}
+
+void ScriptableDebug::PrintMessage(const FString& Message, EScriptableLogSeverity Severity, bool bPrintToScreen, bool bPrintToLog, float Duration, const FColor& TextColor)
 {
 	if (bPrintToLog)
 	{
@@ -37,8 +55,6 @@ void UScriptableTask_LogMessage::BeginTask()
 
 		GEngine->AddOnScreenDebugMessage(-1, Duration, DisplayColor, Message);
 	}
-
-	Finish();
 }
 
 #if WITH_EDITOR
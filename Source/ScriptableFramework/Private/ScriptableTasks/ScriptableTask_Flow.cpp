@@ -1,37 +1,82 @@
 // Copyright 2026 kirzo
 
 #include "ScriptableTasks/ScriptableTask_Flow.h"
+#include "ScriptableTasks/ScriptableActionInstance.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 void UScriptableTask_Wait::BeginTask()
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	UScriptableTimerSubsystem* TimerSubsystem = UWorld::GetSubsystem<UScriptableTimerSubsystem>(GetWorld());
+	if (!TimerSubsystem)
 	{
 		// Fallback: If no world (e.g. asset editor preview), finish immediately to avoid getting stuck.
 		Finish();
 		return;
 	}
 
-	float FinalDuration = Duration;
+	const float FinalDuration = GetRandomDuration();
 
-	if (RandomDeviation > UE_KINDA_SMALL_NUMBER)
+	if (FinalDuration <= UE_KINDA_SMALL_NUMBER)
 	{
-		FinalDuration += FMath::RandRange(-RandomDeviation, RandomDeviation);
+		Finish();
 	}
+	else
+	{
+		// A timer left from a previous run would finish this one early
+		TimerSubsystem->ClearTimer(TimerHandle);
+		TimerHandle = TimerSubsystem->SetTimer(FinalDuration, this, &UScriptableTask_Wait::OnWaitTimer);
+	}
+}
 
-	// Clamp to ensure we don't wait for negative time
-	FinalDuration = FMath::Max(0.0f, FinalDuration);
+void UScriptableTask_Wait::FinishTask()
+{
+	// The action may finish the task before the timer fires
+	UScriptableTimerSubsystem::ClearTimerFor(this, TimerHandle);
+}
 
-	if (FinalDuration <= UE_KINDA_SMALL_NUMBER)
+void UScriptableTask_Wait::BeginShared(const FScriptableTaskInstanceContext& Context) const
+{
+	UScriptableTimerSubsystem* TimerSubsystem = UWorld::GetSubsystem<UScriptableTimerSubsystem>(Context.GetWorld());
+	const float FinalDuration = GetRandomDuration();
+
+	if (!TimerSubsystem || FinalDuration <= UE_KINDA_SMALL_NUMBER)
 	{
-		Finish();
+		Context.Finish();
+		return;
 	}
-	else
+
+	// The run outlives the timer, FinishShared clears it
+	FScriptableTask_WaitInstanceData& InstanceData = Context.GetInstanceData<FScriptableTask_WaitInstanceData>();
+	TimerSubsystem->ClearTimer(InstanceData.TimerHandle);
+	InstanceData.TimerHandle = TimerSubsystem->SetTimer(FinalDuration, Context.GetOwner(), &UScriptableTask_Wait::OnSharedWaitTimer, &Context.GetRun(), Context.GetTaskIndex());
+}
+
+void UScriptableTask_Wait::FinishShared(const FScriptableTaskInstanceContext& Context) const
+{
+	// The run may be finished before the timer fires
+	FScriptableTask_WaitInstanceData& InstanceData = Context.GetInstanceData<FScriptableTask_WaitInstanceData>();
+	UScriptableTimerSubsystem::ClearTimerFor(Context.GetOwner(), InstanceData.TimerHandle);
+}
+
+float UScriptableTask_Wait::GetRandomDuration() const
+{
+	float FinalDuration = Duration;
+
+	if (RandomDeviation > UE_KINDA_SMALL_NUMBER)
 	{
-		World->GetTimerManager().SetTimer(TimerHandle, this, &UScriptableTask_Wait::OnWaitFinished, FinalDuration, false);
+		FinalDuration += FMath::RandRange(-RandomDeviation, RandomDeviation);
 	}
+
+	// Clamp to ensure we don't wait for negative time
+	return FMath::Max(0.0f, FinalDuration);
+}
+
+void UScriptableTask_Wait::OnUnregister()
+{
+	Super::OnUnregister();
+
+	// A pending timer would finish the next run of a pooled instance
+	UScriptableTimerSubsystem::ClearTimerFor(this, TimerHandle);
 }
 
 void UScriptableTask_Wait::OnWaitFinished()
@@ -39,6 +84,22 @@ void UScriptableTask_Wait::OnWaitFinished()
 	Finish();
 }
 
+void UScriptableTask_Wait::OnWaitTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+	UScriptableTask_Wait* Wait = static_cast<UScriptableTask_Wait*>(Target);
+	Wait->TimerHandle.Invalidate();
+	Wait->OnWaitFinished();
+}
+
+void UScriptableTask_Wait::OnSharedWaitTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+	FScriptableActionInstance& Run = *static_cast<FScriptableActionInstance*>(Payload);
+	const FScriptableTaskInstanceContext Context(Run, PayloadIndex);
+
+	Context.GetInstanceData<FScriptableTask_WaitInstanceData>().TimerHandle.Invalidate();
+	Context.Finish();
+}
+
 #if WITH_EDITOR
 FText UScriptableTask_Wait::GetDisplayTitle() const
 {
@@ -0,0 +1,442 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTickScheduler.h"
+#include "ScriptableObject.h"
+#include "Bindings/ScriptableBindingSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static bool GScriptableTickScheduler = true;
+static FAutoConsoleVariableRef CVarScriptableTickScheduler(
+	TEXT("Scriptable.Tick.Scheduler"),
+	GScriptableTickScheduler,
+	TEXT("If true, ticking scriptable objects are ticked in batches by their world's tick scheduler instead of registering a tick function each. Applies to objects that start ticking afterwards."));
+
+void FScriptableTickGroupFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FScriptableTickGroupFunction::ExecuteTick);
+
+	if (IsValid(Target))
+	{
+		Target->TickScheduledGroup(TickGroup, DeltaTime, TickType);
+	}
+}
+
+FString FScriptableTickGroupFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UScriptableTickSchedulerSubsystem[TickGroup %d]"), static_cast<int32>(TickGroup.GetValue()));
+}
+
+FName FScriptableTickGroupFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("ScriptableTickSchedulerSubsystem"));
+}
+
+void UScriptableTickSchedulerSubsystem::Deinitialize()
+{
+	for (FScriptableTickGroupFunction& TickFunction : TickFunctions)
+	{
+		if (TickFunction.IsTickFunctionRegistered())
+		{
+			TickFunction.UnRegisterTickFunction();
+		}
+
+		TickFunction.Target = nullptr;
+	}
+
+	// Objects still scheduled fall back to their own tick function state
+	for (FScriptableTickGroup& Group : Groups)
+	{
+		for (FScriptableTickBucket& Bucket : Group.Buckets)
+		{
+			for (UScriptableObject* Object : Bucket.Objects)
+			{
+				if (Object)
+				{
+					Object->TickSlot = FScriptableTickSlot();
+				}
+			}
+		}
+	}
+
+	Groups.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UScriptableTickSchedulerSubsystem::CanSchedule(const FTickFunction& TickFunction)
+{
+	return GScriptableTickScheduler
+		&& TickFunction.TickInterval <= 0.f
+		&& !TickFunction.bTickEvenWhenPaused
+		&& !TickFunction.bHighPriority
+		&& TickFunction.GetPrerequisites().IsEmpty();
+}
+
+void UScriptableTickSchedulerSubsystem::AddObject(UScriptableObject* Object)
+{
+	check(Object && !Object->TickSlot.IsValid());
+
+	if (Groups.IsEmpty())
+	{
+		Groups.SetNum(TG_MAX);
+	}
+
+	FTickFunction& ObjectTick = Object->PrimaryObjectTick;
+	const int32 GroupIndex = FMath::Clamp<int32>(ObjectTick.TickGroup, TG_PrePhysics, TG_LastDemotable);
+	FScriptableTickGroup& Group = Groups[GroupIndex];
+
+	const UClass* Class = Object->GetClass();
+	int32 BucketIndex = Group.Buckets.IndexOfByPredicate([Class](const FScriptableTickBucket& Bucket) { return Bucket.Class == Class; });
+	if (BucketIndex == INDEX_NONE)
+	{
+		BucketIndex = Group.Buckets.AddDefaulted();
+		Group.Buckets[BucketIndex].Class = Class;
+	}
+
+	FScriptableTickBucket& Bucket = Group.Buckets[BucketIndex];
+
+	// Same rule as UScriptableObject::SetupTickFunction, the tick function keeps the enabled state
+	const bool bEnabled = ObjectTick.bStartWithTickEnabled || ObjectTick.IsTickFunctionEnabled();
+	ObjectTick.SetTickFunctionEnable(bEnabled);
+
+	const int32 Index = Bucket.Objects.Add(Object);
+	Bucket.OwnerActors.Add(Object->GetOwner<AActor>());
+
+	FScriptableTickSlot& Slot = Object->TickSlot;
+	Slot.Group = GroupIndex;
+	Slot.Bucket = BucketIndex;
+	Slot.Index = Index;
+	Slot.bEnabled = bEnabled;
+
+	++Group.NumObjects;
+
+	if (bEnabled)
+	{
+		++Group.NumEnabled;
+
+		if (TickingGroup == GroupIndex)
+		{
+			Bucket.bDirty = true;
+		}
+		else
+		{
+			SwapObjects(Bucket, Index, Bucket.NumEnabled);
+			++Bucket.NumEnabled;
+		}
+	}
+
+	RegisterGroupTickFunction(GroupIndex);
+	UpdateGroupTickFunction(GroupIndex);
+}
+
+void UScriptableTickSchedulerSubsystem::RemoveObject(UScriptableObject* Object)
+{
+	if (!Object || !Object->TickSlot.IsValid())
+	{
+		return;
+	}
+
+	const FScriptableTickSlot Slot = Object->TickSlot;
+	Object->TickSlot = FScriptableTickSlot();
+
+	FScriptableTickGroup& Group = Groups[Slot.Group];
+	FScriptableTickBucket& Bucket = Group.Buckets[Slot.Bucket];
+	check(Bucket.Objects[Slot.Index] == Object);
+
+	--Group.NumObjects;
+	if (Slot.bEnabled)
+	{
+		--Group.NumEnabled;
+	}
+
+	if (TickingGroup == Slot.Group)
+	{
+		// The group is iterating the bucket, leave a hole and compact once it is done
+		Bucket.Objects[Slot.Index] = nullptr;
+		Bucket.OwnerActors[Slot.Index] = nullptr;
+		Bucket.bDirty = true;
+	}
+	else
+	{
+		int32 Index = Slot.Index;
+		if (Index < Bucket.NumEnabled)
+		{
+			--Bucket.NumEnabled;
+			SwapObjects(Bucket, Index, Bucket.NumEnabled);
+			Index = Bucket.NumEnabled;
+		}
+
+		SwapObjects(Bucket, Index, Bucket.Objects.Num() - 1);
+		Bucket.Objects.Pop(EAllowShrinking::No);
+		Bucket.OwnerActors.Pop(EAllowShrinking::No);
+	}
+
+	UpdateGroupTickFunction(Slot.Group);
+}
+
+void UScriptableTickSchedulerSubsystem::SetObjectTickEnabled(UScriptableObject* Object, bool bEnabled)
+{
+	if (!Object || !Object->TickSlot.IsValid() || Object->TickSlot.bEnabled == bEnabled)
+	{
+		return;
+	}
+
+	FScriptableTickSlot& Slot = Object->TickSlot;
+	const int32 GroupIndex = Slot.Group;
+	FScriptableTickGroup& Group = Groups[GroupIndex];
+	FScriptableTickBucket& Bucket = Group.Buckets[Slot.Bucket];
+
+	Slot.bEnabled = bEnabled;
+	Group.NumEnabled += bEnabled ? 1 : -1;
+
+	if (TickingGroup == GroupIndex)
+	{
+		Bucket.bDirty = true;
+	}
+	else if (bEnabled)
+	{
+		SwapObjects(Bucket, Slot.Index, Bucket.NumEnabled);
+		++Bucket.NumEnabled;
+	}
+	else
+	{
+		--Bucket.NumEnabled;
+		SwapObjects(Bucket, Slot.Index, Bucket.NumEnabled);
+	}
+
+	UpdateGroupTickFunction(GroupIndex);
+}
+
+int32 UScriptableTickSchedulerSubsystem::GetNumObjects() const
+{
+	int32 Num = 0;
+	for (const FScriptableTickGroup& Group : Groups)
+	{
+		Num += Group.NumObjects;
+	}
+	return Num;
+}
+
+int32 UScriptableTickSchedulerSubsystem::GetNumEnabledObjects() const
+{
+	int32 Num = 0;
+	for (const FScriptableTickGroup& Group : Groups)
+	{
+		Num += Group.NumEnabled;
+	}
+	return Num;
+}
+
+void UScriptableTickSchedulerSubsystem::TickScheduledGroup(int32 GroupIndex, float DeltaTime, ELevelTick TickType)
+{
+	if (!Groups.IsValidIndex(GroupIndex))
+	{
+		return;
+	}
+
+	FScriptableTickGroup& Group = Groups[GroupIndex];
+	const bool bViewportsOnly = TickType == LEVELTICK_ViewportsOnly;
+
+	TickingGroup = GroupIndex;
+
+	// Ticks can add objects and classes, so indices are used rather than references into the arrays.
+	// Objects added or enabled during the tick start ticking next frame.
+	const int32 NumBuckets = Group.Buckets.Num();
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		const int32 NumToTick = Group.Buckets[BucketIndex].NumEnabled;
+		for (int32 Index = 0; Index < NumToTick; ++Index)
+		{
+			FScriptableTickBucket& Bucket = Group.Buckets[BucketIndex];
+
+			UScriptableObject* Object = Bucket.Objects[Index];
+			if (!Object)
+			{
+				// Removed during this tick, or collected without being removed
+				Bucket.bDirty = true;
+				continue;
+			}
+
+			if (!Object->TickSlot.bEnabled || !IsValid(Object) || !Object->IsRegistered() || !Object->IsReadyToTick())
+			{
+				continue;
+			}
+
+			AActor* OwnerActor = Bucket.OwnerActors[Index];
+			if (bViewportsOnly && !(OwnerActor && OwnerActor->ShouldTickIfViewportsOnly()))
+			{
+				continue;
+			}
+
+			Object->Tick(OwnerActor ? DeltaTime * OwnerActor->CustomTimeDilation : DeltaTime);
+			Object->MarkOutputsChanged();
+		}
+	}
+
+	TickingGroup = INDEX_NONE;
+
+	bool bCompacted = false;
+	for (FScriptableTickBucket& Bucket : Group.Buckets)
+	{
+		if (Bucket.bDirty)
+		{
+			CompactBucket(Bucket);
+			bCompacted = true;
+		}
+	}
+
+	if (bCompacted)
+	{
+		Group.NumObjects = 0;
+		Group.NumEnabled = 0;
+
+		for (const FScriptableTickBucket& Bucket : Group.Buckets)
+		{
+			Group.NumObjects += Bucket.Objects.Num();
+			Group.NumEnabled += Bucket.NumEnabled;
+		}
+	}
+
+	UpdateGroupTickFunction(GroupIndex);
+}
+
+void UScriptableTickSchedulerSubsystem::RegisterGroupTickFunction(int32 GroupIndex)
+{
+	FScriptableTickGroupFunction& TickFunction = TickFunctions[GroupIndex];
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World || !World->PersistentLevel)
+	{
+		return;
+	}
+
+	// Only enabled while the group has enabled objects
+	TickFunction.Target = this;
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = false;
+	TickFunction.TickGroup = static_cast<ETickingGroup>(GroupIndex);
+	TickFunction.RegisterTickFunction(World->PersistentLevel);
+
+	// Tick bindings are resolved before the objects tick, as with their own tick functions
+	if (UScriptableBindingSubsystem* BindingSubsystem = UWorld::GetSubsystem<UScriptableBindingSubsystem>(World))
+	{
+		BindingSubsystem->AddTickPrerequisite(TickFunction);
+	}
+}
+
+void UScriptableTickSchedulerSubsystem::UpdateGroupTickFunction(int32 GroupIndex)
+{
+	// The ticking group is updated once it is done
+	if (GroupIndex == TickingGroup)
+	{
+		return;
+	}
+
+	FScriptableTickGroupFunction& TickFunction = TickFunctions[GroupIndex];
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(Groups[GroupIndex].NumEnabled > 0);
+	}
+}
+
+void UScriptableTickSchedulerSubsystem::SwapObjects(FScriptableTickBucket& Bucket, int32 IndexA, int32 IndexB)
+{
+	if (IndexA == IndexB)
+	{
+		return;
+	}
+
+	Bucket.Objects.Swap(IndexA, IndexB);
+	Bucket.OwnerActors.Swap(IndexA, IndexB);
+
+	if (UScriptableObject* Object = Bucket.Objects[IndexA])
+	{
+		Object->TickSlot.Index = IndexA;
+	}
+
+	if (UScriptableObject* Object = Bucket.Objects[IndexB])
+	{
+		Object->TickSlot.Index = IndexB;
+	}
+}
+
+void UScriptableTickSchedulerSubsystem::CompactBucket(FScriptableTickBucket& Bucket)
+{
+	int32 NumKept = 0;
+	for (int32 Index = 0; Index < Bucket.Objects.Num(); ++Index)
+	{
+		if (UScriptableObject* Object = Bucket.Objects[Index])
+		{
+			Bucket.Objects[NumKept] = Object;
+			Bucket.OwnerActors[NumKept] = Bucket.OwnerActors[Index];
+			Object->TickSlot.Index = NumKept;
+			++NumKept;
+		}
+	}
+
+	Bucket.Objects.SetNum(NumKept, EAllowShrinking::No);
+	Bucket.OwnerActors.SetNum(NumKept, EAllowShrinking::No);
+
+	Bucket.NumEnabled = 0;
+	for (int32 Index = 0; Index < NumKept; ++Index)
+	{
+		if (Bucket.Objects[Index]->TickSlot.bEnabled)
+		{
+			SwapObjects(Bucket, Index, Bucket.NumEnabled);
+			++Bucket.NumEnabled;
+		}
+	}
+
+	Bucket.bDirty = false;
+}
+
+void UScriptableTickSchedulerSubsystem::DumpStats() const
+{
+	UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Tick.Stats (%s): %d objects scheduled, %d enabled"),
+		*GetWorld()->GetName(), GetNumObjects(), GetNumEnabledObjects());
+
+	const UEnum* TickGroupEnum = StaticEnum<ETickingGroup>();
+	for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+	{
+		const FScriptableTickGroup& Group = Groups[GroupIndex];
+		if (Group.NumObjects == 0)
+		{
+			continue;
+		}
+
+		UE_LOG(LogScriptableObject, Display, TEXT("  %s: %d objects, %d enabled"),
+			*TickGroupEnum->GetNameStringByValue(GroupIndex), Group.NumObjects, Group.NumEnabled);
+
+		for (const FScriptableTickBucket& Bucket : Group.Buckets)
+		{
+			if (!Bucket.Objects.IsEmpty())
+			{
+				UE_LOG(LogScriptableObject, Display, TEXT("    %s: %d objects, %d enabled"),
+					*GetNameSafe(Bucket.Class), Bucket.Objects.Num(), Bucket.NumEnabled);
+			}
+		}
+	}
+}
+
+static void DumpTickSchedulerStats(UWorld* World)
+{
+	const UScriptableTickSchedulerSubsystem* Scheduler = UWorld::GetSubsystem<UScriptableTickSchedulerSubsystem>(World);
+	if (!Scheduler)
+	{
+		UE_LOG(LogScriptableObject, Display, TEXT("Scriptable.Tick.Stats: no tick scheduler in this world."));
+		return;
+	}
+
+	Scheduler->DumpStats();
+}
+
+static FAutoConsoleCommand DumpTickSchedulerStatsCommand(
+	TEXT("Scriptable.Tick.Stats"),
+	TEXT("Logs the objects ticked by the tick scheduler of the current world, per tick group and class."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&DumpTickSchedulerStats));
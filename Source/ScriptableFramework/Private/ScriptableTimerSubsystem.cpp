@@ -0,0 +1,456 @@
+// Copyright 2026 kirzo
+
+#include "ScriptableTimerSubsystem.h"
+#include "ScriptableTasks/ScriptableTask.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+static float GScriptableTimerResolution = 0.001f;
+static FAutoConsoleVariableRef CVarScriptableTimerResolution(
+	TEXT("Scriptable.Timer.Resolution"),
+	GScriptableTimerResolution,
+	TEXT("Length in seconds of a tick of the timer wheel used by Wait and loop delays. Timers may fire up to one tick late. Applies to worlds created afterwards."));
+
+void FScriptableTimerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FScriptableTimerTickFunction::ExecuteTick);
+
+	if (IsValid(Target))
+	{
+		Target->Advance(DeltaTime);
+	}
+}
+
+FString FScriptableTimerTickFunction::DiagnosticMessage()
+{
+	return TEXT("UScriptableTimerSubsystem[Advance]");
+}
+
+FName FScriptableTimerTickFunction::DiagnosticContext(bool bDetailed)
+{
+	return FName(TEXT("ScriptableTimerSubsystem"));
+}
+
+void UScriptableTimerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TickResolution = FMath::Max(static_cast<double>(GScriptableTimerResolution), 0.0001);
+
+	for (int32& Head : SlotHeads)
+	{
+		Head = INDEX_NONE;
+	}
+
+	for (int32& Num : NumInLevel)
+	{
+		Num = 0;
+	}
+}
+
+void UScriptableTimerSubsystem::PostInitialize()
+{
+	Super::PostInitialize();
+
+	UWorld* World = GetWorld();
+	if (World && World->PersistentLevel)
+	{
+		// Only enabled while there are timers. Like FTimerManager, it doesn't tick while the game is paused.
+		TickFunction.Target = this;
+		TickFunction.bCanEverTick = true;
+		TickFunction.bStartWithTickEnabled = false;
+		TickFunction.TickGroup = TG_PrePhysics;
+		TickFunction.RegisterTickFunction(World->PersistentLevel);
+	}
+}
+
+void UScriptableTimerSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+
+	TickFunction.Target = nullptr;
+
+	Timers.Empty();
+	FreeTimers.Empty();
+	ExpiredTimers.Empty();
+	NumTimers = 0;
+
+	Super::Deinitialize();
+}
+
+FScriptableTimerHandle UScriptableTimerSubsystem::SetTimer(float Delay, UObject* Target, FScriptableTimerFunction Function, void* Payload, int32 PayloadIndex)
+{
+	check(Function);
+
+	const int32 Index = FreeTimers.IsEmpty() ? Timers.AddDefaulted() : FreeTimers.Pop(EAllowShrinking::No);
+	FTimer& Timer = Timers[Index];
+	Timer.Target = Target;
+	Timer.Function = Function;
+	Timer.Payload = Payload;
+	Timer.PayloadIndex = PayloadIndex;
+
+	// Rounded up so it never fires early, and at the earliest on the next frame
+	const uint64 DelayedTick = static_cast<uint64>(FMath::CeilToDouble((ElapsedTime + FMath::Max(Delay, 0.0f)) / TickResolution));
+	Timer.ExpireTick = FMath::Max(CurrentTick + 1, DelayedTick);
+
+	Timer.Serial = NextSerial++;
+	if (NextSerial == 0)
+	{
+		NextSerial = 1;
+	}
+
+	LinkTimer(Index);
+	++NumTimers;
+
+	UpdateTickFunction();
+
+	FScriptableTimerHandle Handle;
+	Handle.Index = Index;
+	Handle.Serial = Timer.Serial;
+	return Handle;
+}
+
+void UScriptableTimerSubsystem::ClearTimer(FScriptableTimerHandle& Handle)
+{
+	if (FindTimer(Handle))
+	{
+		if (Timers[Handle.Index].Slot != INDEX_NONE)
+		{
+			UnlinkTimer(Handle.Index);
+		}
+
+		// Expired timers waiting to fire are skipped once freed
+		FreeTimer(Handle.Index);
+		UpdateTickFunction();
+	}
+
+	Handle.Invalidate();
+}
+
+bool UScriptableTimerSubsystem::IsTimerActive(const FScriptableTimerHandle& Handle) const
+{
+	return FindTimer(Handle) != nullptr;
+}
+
+float UScriptableTimerSubsystem::GetTimerRemaining(const FScriptableTimerHandle& Handle) const
+{
+	const FTimer* Timer = FindTimer(Handle);
+	if (!Timer)
+	{
+		return -1.0f;
+	}
+
+	if (Timer->Slot == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	return static_cast<float>(FMath::Max(0.0, Timer->ExpireTick * TickResolution - ElapsedTime));
+}
+
+void UScriptableTimerSubsystem::Advance(float DeltaTime)
+{
+	ElapsedTime += DeltaTime;
+	const uint64 TargetTick = static_cast<uint64>(ElapsedTime / TickResolution);
+
+	while (CurrentTick < TargetTick)
+	{
+		int32 NumLinked = 0;
+		for (int32 Num : NumInLevel)
+		{
+			NumLinked += Num;
+		}
+
+		if (NumLinked == 0)
+		{
+			CurrentTick = TargetTick;
+			break;
+		}
+
+		if (NumInLevel[0] == 0)
+		{
+			// Nothing expires before level 0 wraps around and the upper levels cascade, skip to it
+			const uint64 LastTickOfRotation = CurrentTick | SlotMask;
+			if (LastTickOfRotation >= TargetTick)
+			{
+				CurrentTick = TargetTick;
+				break;
+			}
+
+			CurrentTick = LastTickOfRotation;
+		}
+
+		++CurrentTick;
+
+		if ((CurrentTick & SlotMask) == 0)
+		{
+			for (int32 Level = 1; Level < NumLevels; ++Level)
+			{
+				const int32 SlotIndex = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & SlotMask);
+				CascadeSlot(Level, SlotIndex);
+
+				if (SlotIndex != 0)
+				{
+					break;
+				}
+			}
+		}
+
+		ExpireCurrentSlot();
+	}
+
+	// Fired once the wheel is up to date, so timers set by the callbacks count from the end of the frame.
+	// New expirations can't be added while firing, the list is only filled above.
+	for (int32 ExpiredIndex = 0; ExpiredIndex < ExpiredTimers.Num(); ++ExpiredIndex)
+	{
+		const FExpiredTimer Expired = ExpiredTimers[ExpiredIndex];
+
+		FTimer& Timer = Timers[Expired.Index];
+		if (Timer.Serial != Expired.Serial)
+		{
+			// Cleared by a timer that fired before it
+			continue;
+		}
+
+		UObject* Target = Timer.Target.Get();
+		const FScriptableTimerFunction Function = Timer.Function;
+		void* Payload = Timer.Payload;
+		const int32 PayloadIndex = Timer.PayloadIndex;
+
+		FreeTimer(Expired.Index);
+
+		if (Target)
+		{
+			Function(Target, Payload, PayloadIndex);
+		}
+	}
+
+	ExpiredTimers.Reset();
+
+	UpdateTickFunction();
+}
+
+FScriptableTimerHandle UScriptableTimerSubsystem::SetTimerFor(UObject* Target, float Delay, FScriptableTimerFunction Function, void* Payload, int32 PayloadIndex)
+{
+	if (UScriptableTimerSubsystem* TimerSubsystem = Target ? UWorld::GetSubsystem<UScriptableTimerSubsystem>(Target->GetWorld()) : nullptr)
+	{
+		return TimerSubsystem->SetTimer(Delay, Target, Function, Payload, PayloadIndex);
+	}
+
+	return FScriptableTimerHandle();
+}
+
+void UScriptableTimerSubsystem::ClearTimerFor(const UObject* WorldContextObject, FScriptableTimerHandle& Handle)
+{
+	if (Handle.IsValid() && WorldContextObject)
+	{
+		if (UScriptableTimerSubsystem* TimerSubsystem = UWorld::GetSubsystem<UScriptableTimerSubsystem>(WorldContextObject->GetWorld()))
+		{
+			TimerSubsystem->ClearTimer(Handle);
+		}
+	}
+
+	Handle.Invalidate();
+}
+
+const UScriptableTimerSubsystem::FTimer* UScriptableTimerSubsystem::FindTimer(const FScriptableTimerHandle& Handle) const
+{
+	if (Handle.IsValid() && Timers.IsValidIndex(Handle.Index) && Timers[Handle.Index].Serial == Handle.Serial)
+	{
+		return &Timers[Handle.Index];
+	}
+
+	return nullptr;
+}
+
+void UScriptableTimerSubsystem::LinkTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+
+	// Ticks are cascaded before they expire, so a timer of the current tick can still be linked to it
+	const uint64 Delta = Timer.ExpireTick > CurrentTick ? Timer.ExpireTick - CurrentTick : 0;
+
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+	{
+		++Level;
+	}
+
+	// Beyond the reach of the wheel: parked in the furthest slot, and linked again when it cascades
+	const uint64 WheelSpan = uint64(1) << (SlotBits * NumLevels);
+	const uint64 PlacementTick = Delta < WheelSpan ? Timer.ExpireTick : CurrentTick + WheelSpan - 1;
+
+	const int32 Slot = Level * NumSlots + static_cast<int32>((PlacementTick >> (SlotBits * Level)) & SlotMask);
+
+	Timer.Slot = Slot;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = SlotHeads[Slot];
+
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = Index;
+	}
+
+	SlotHeads[Slot] = Index;
+	++NumInLevel[Level];
+}
+
+void UScriptableTimerSubsystem::UnlinkTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+	check(Timer.Slot != INDEX_NONE);
+
+	if (Timer.Prev != INDEX_NONE)
+	{
+		Timers[Timer.Prev].Next = Timer.Next;
+	}
+	else
+	{
+		SlotHeads[Timer.Slot] = Timer.Next;
+	}
+
+	if (Timer.Next != INDEX_NONE)
+	{
+		Timers[Timer.Next].Prev = Timer.Prev;
+	}
+
+	--NumInLevel[Timer.Slot / NumSlots];
+
+	Timer.Slot = INDEX_NONE;
+	Timer.Prev = INDEX_NONE;
+	Timer.Next = INDEX_NONE;
+}
+
+void UScriptableTimerSubsystem::FreeTimer(int32 Index)
+{
+	FTimer& Timer = Timers[Index];
+	Timer.Target.Reset();
+	Timer.Function = nullptr;
+	Timer.Payload = nullptr;
+	Timer.Serial = 0;
+
+	FreeTimers.Add(Index);
+	--NumTimers;
+}
+
+void UScriptableTimerSubsystem::CascadeSlot(int32 Level, int32 SlotIndex)
+{
+	const int32 Slot = Level * NumSlots + SlotIndex;
+
+	int32 Index = SlotHeads[Slot];
+	SlotHeads[Slot] = INDEX_NONE;
+
+	while (Index != INDEX_NONE)
+	{
+		const int32 Next = Timers[Index].Next;
+
+		--NumInLevel[Level];
+		LinkTimer(Index);
+
+		Index = Next;
+	}
+}
+
+void UScriptableTimerSubsystem::ExpireCurrentSlot()
+{
+	const int32 Slot = static_cast<int32>(CurrentTick & SlotMask);
+
+	int32 Index = SlotHeads[Slot];
+	SlotHeads[Slot] = INDEX_NONE;
+
+	while (Index != INDEX_NONE)
+	{
+		FTimer& Timer = Timers[Index];
+		const int32 Next = Timer.Next;
+
+		Timer.Slot = INDEX_NONE;
+		Timer.Prev = INDEX_NONE;
+		Timer.Next = INDEX_NONE;
+		--NumInLevel[0];
+
+		ExpiredTimers.Add({ Index, Timer.Serial });
+
+		Index = Next;
+	}
+}
+
+void UScriptableTimerSubsystem::UpdateTickFunction()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(NumTimers > 0);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static void NoOpTimer(UObject* Target, void* Payload, int32 PayloadIndex)
+{
+}
+
+/**
+ * Benchmark of setting and clearing many timers, as Wait tasks do, on FTimerManager against the timer wheel.
+ * Usage: Scriptable.Bench.Timers [NumTimers]
+ */
+static void BenchmarkTimers(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 NumTimers = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+
+	UScriptableTimerSubsystem* TimerSubsystem = UWorld::GetSubsystem<UScriptableTimerSubsystem>(World);
+	UObject* Owner = World ? World->GetWorldSettings() : nullptr;
+	if (!TimerSubsystem || !Owner)
+	{
+		UE_LOG(LogScriptableTask, Warning, TEXT("Scriptable.Bench.Timers: requires a world."));
+		return;
+	}
+
+	FRandomStream Random(NumTimers);
+	TArray<float> Delays;
+	Delays.SetNumUninitialized(NumTimers);
+	for (float& Delay : Delays)
+	{
+		Delay = Random.FRandRange(0.1f, 60.0f);
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	TArray<FTimerHandle> ManagerHandles;
+	ManagerHandles.SetNum(NumTimers);
+
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		TimerManager.SetTimer(ManagerHandles[Index], FTimerDelegate::CreateWeakLambda(Owner, []() {}), Delays[Index], false);
+	}
+	for (FTimerHandle& Handle : ManagerHandles)
+	{
+		TimerManager.ClearTimer(Handle);
+	}
+	const double ManagerMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	TArray<FScriptableTimerHandle> WheelHandles;
+	WheelHandles.SetNum(NumTimers);
+
+	StartCycles = FPlatformTime::Cycles64();
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		WheelHandles[Index] = TimerSubsystem->SetTimer(Delays[Index], Owner, &NoOpTimer);
+	}
+	for (FScriptableTimerHandle& Handle : WheelHandles)
+	{
+		TimerSubsystem->ClearTimer(Handle);
+	}
+	const double WheelMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+	UE_LOG(LogScriptableTask, Display, TEXT("Scriptable.Bench.Timers (%d timers set and cleared): FTimerManager %.3f ms, timer wheel %.3f ms. Speedup x%.2f"),
+		NumTimers, ManagerMs, WheelMs, WheelMs > 0.0 ? ManagerMs / WheelMs : 0.0);
+}
+
+static FAutoConsoleCommand BenchmarkTimersCommand(
+	TEXT("Scriptable.Bench.Timers"),
+	TEXT("Compares setting and clearing many timers on FTimerManager against the timer wheel of the Wait task. Usage: Scriptable.Bench.Timers [NumTimers]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&BenchmarkTimers));
+#endif
@@ -0,0 +1,318 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Script.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+struct FPropertyBindingPath;
+struct FPropertyBindingDataView;
+class UScriptableObject;
+
+/**
+ * Per-thread stack of parameter frames used to call the getters found in binding paths.
+ * Frames are carved out of memory blocks that are kept alive for the lifetime of the thread,
+ * so function-backed bindings do not allocate once the blocks are warm.
+ */
+class SCRIPTABLEFRAMEWORK_API FScriptableBindingScratch
+{
+public:
+	/** Returns the scratch stack of the calling thread. */
+	static FScriptableBindingScratch& Get();
+
+	/** Releases every frame pushed while the scope was alive. Frames must not outlive it. */
+	struct FScope
+	{
+		FScope();
+		~FScope();
+
+	private:
+		FScriptableBindingScratch& Scratch;
+		int32 BlockIndex;
+		int32 BlockOffset;
+		int32 NumFrames;
+	};
+
+	/**
+	 * Reserves a parameter frame of Function->ParmsSize bytes and initializes its parameters.
+	 * @param bTrivialParms If true, the parameters are zeroed instead of constructed and won't be destroyed.
+	 */
+	uint8* PushFrame(const UFunction* Function, bool bTrivialParms);
+
+	/** Returns true if every parameter of the function can be zero-constructed and needs no destructor. */
+	static bool HasTrivialParameters(const UFunction* Function);
+
+	FScriptableBindingScratch() = default;
+	~FScriptableBindingScratch();
+
+	UE_NONCOPYABLE(FScriptableBindingScratch);
+
+private:
+	struct FBlock
+	{
+		uint8* Memory = nullptr;
+		int32 Size = 0;
+	};
+
+	struct FFrame
+	{
+		const UFunction* Function = nullptr;
+		uint8* Memory = nullptr;
+	};
+
+	void PopTo(int32 InBlockIndex, int32 InBlockOffset, int32 InNumFrames);
+
+	TArray<FBlock> Blocks;
+
+	/** Frames that need their parameters destroyed when released. */
+	TArray<FFrame> Frames;
+
+	int32 CurrentBlock = 0;
+	int32 CurrentOffset = 0;
+};
+
+/** Describes how a compiled segment continues into the next one. */
+enum class EScriptableBindingHop : uint8
+{
+	/** Last segment of the path, the walk ends here. */
+	None,
+
+	/** The value is a plain struct, keep walking in place. */
+	Struct,
+
+	/** The value is an FInstancedPropertyBag, continue inside its value memory. */
+	PropertyBag,
+
+	/** The value is an object reference, continue inside the referenced object. */
+	Object
+};
+
+/** Result of compiling a binding path against a data view. */
+enum class EScriptableBindingCompileResult : uint8
+{
+	/** The plan is ready to be walked. */
+	Compiled,
+
+	/** The path is valid but some runtime memory was missing (e.g. a null object mid-path). Try again later. */
+	Retry,
+
+	/** The path does not exist in the given struct. It will not compile until the layout changes. */
+	Invalid
+};
+
+/** A single pre-resolved step of a binding path. */
+struct FScriptableBindingSegment
+{
+	/** Property read by this segment (the return property for function segments). */
+	const FProperty* Property = nullptr;
+
+	/** Set when the segment addresses an element of an array. */
+	const FArrayProperty* ArrayProperty = nullptr;
+
+	/** Set when the segment calls a getter instead of reading a property. */
+	UFunction* Function = nullptr;
+
+	/** Native thunk of the getter when it is a parameterless native pure function. Called without going through ProcessEvent. */
+	FNativeFuncPtr NativeGetter = nullptr;
+
+	/** When set, the object walked into must be of this class (property found on a derived runtime class). */
+	TWeakObjectPtr<const UClass> RequiredClass;
+
+	/** Bag layout the next segments were compiled against (PropertyBag hops only). */
+	TWeakObjectPtr<const UStruct> ExpectedBagStruct;
+
+	/** Byte offset of the property inside the current container. */
+	int32 Offset = 0;
+
+	/** Element index for array segments. */
+	int32 ArrayIndex = INDEX_NONE;
+
+	/** True if the function can be overridden by Blueprints and must be looked up on the runtime class. */
+	bool bVirtualFunction = false;
+
+	/** True if the function parameters can be zeroed instead of constructed. */
+	bool bTrivialParms = false;
+
+	/** How to continue into the next segment. */
+	EScriptableBindingHop Hop = EScriptableBindingHop::None;
+};
+
+/**
+ * A binding path compiled against a specific struct layout.
+ * Turns FName lookups into a short pointer walk over cached properties and offsets.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableBindingPathPlan
+{
+	/** Compiles the path against the given view. Runtime memory is used to discover nested bag layouts. */
+	EScriptableBindingCompileResult Compile(const FPropertyBindingPath& Path, const FPropertyBindingDataView& View);
+
+	/**
+	 * Walks the plan starting at RootMemory.
+	 * Function return values live in the scratch frames, the caller must keep a FScriptableBindingScratch::FScope open until the copy is done.
+	 * @param bOutStale Set when a nested bag no longer matches the compiled layout. The plan must be recompiled.
+	 * @return Address of the leaf value, or nullptr if the walk could not complete.
+	 */
+	void* Walk(void* RootMemory, FScriptableBindingScratch& Scratch, bool& bOutStale) const;
+
+	/** Returns true if the plan was compiled against this root struct. */
+	bool IsCompiledFor(const UStruct* Struct) const { return Struct && RootStruct.Get() == Struct; }
+
+	/**
+	 * Returns true if the leaf always lives at the same offset from the root memory,
+	 * i.e. the path only goes through plain properties and nested structs.
+	 */
+	bool GetStaticOffset(int32& OutOffset) const;
+
+	void Reset();
+
+	/** Property at the end of the path. */
+	const FProperty* LeafProperty = nullptr;
+
+	TArray<FScriptableBindingSegment, TInlineAllocator<2>> Segments;
+
+	/** Struct (class or bag) the plan was compiled against. */
+	TWeakObjectPtr<const UStruct> RootStruct;
+
+	/** Result of the last compilation. */
+	EScriptableBindingCompileResult CompileResult = EScriptableBindingCompileResult::Retry;
+
+	/** True if the walk never leaves the root memory (no object hops or getter calls), so the value only changes when the root data is written. */
+	bool bOwnedMemoryOnly = false;
+
+	/** True if the walk calls a getter, so the leaf lives in scratch memory that is released after the copy. */
+	bool bCallsFunction = false;
+};
+
+/**
+ * Change stamp of a block of binding source data (a context bag or the outputs of an object).
+ * Stamps come from a single global counter, so two equal stamps always refer to the same unchanged data.
+ * Copies get a new stamp, as the copied data can diverge from the original.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableDataVersion
+{
+	FScriptableDataVersion() : Value(Allocate()) {}
+	FScriptableDataVersion(const FScriptableDataVersion&) : Value(Allocate()) {}
+	FScriptableDataVersion& operator=(const FScriptableDataVersion&) { Bump(); return *this; }
+
+	/** Call after the data was written. */
+	void Bump() { Value = Allocate(); }
+
+	uint64 Get() const { return Value; }
+
+private:
+	static uint64 Allocate();
+
+	uint64 Value;
+};
+
+/** Kind of copy selected for a binding once its source and target leaf properties are known. */
+enum class EScriptableBindingConversion : uint8
+{
+	/** The types are not compatible, nothing is copied. */
+	None,
+
+	/** Same plain-old-data type, copied as raw bytes. */
+	Memcpy,
+
+	/** Same non-POD type, copied through the property. */
+	CopyValue,
+
+	/** Bool to bool. Handles bitfields. */
+	Bool,
+
+	/** Object to object. The class check is skipped when the source class always fits the target. */
+	Object,
+
+	/** Object to bool (true if not null). */
+	ObjectToBool,
+
+	/** Numeric to numeric of a different type. */
+	Numeric,
+
+	/** Bool to numeric (true = 1, false = 0). */
+	BoolToNumeric,
+
+	/** Numeric to bool (true if not zero). */
+	NumericToBool,
+
+	/** Any value to a FScriptablePropertyRef, which points to the source value instead of copying it. */
+	Reference
+};
+
+/**
+ * Copies values between two leaf properties through a kernel selected once for their types,
+ * so the per-copy cost is a single indirect call instead of a chain of casts and type checks.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableBindingConversion
+{
+	using FKernel = void (*)(const FScriptableBindingConversion& Conversion, const void* SourceAddr, void* TargetAddr);
+
+	/** Selects the kernel converting SourceProperty values into TargetProperty values. */
+	void Select(const FProperty* InSourceProperty, const FProperty* InTargetProperty);
+
+	/** Returns true if the kernel was selected for these properties. */
+	bool IsSelectedFor(const FProperty* InSourceProperty, const FProperty* InTargetProperty) const
+	{
+		return Kernel && SourceProperty == InSourceProperty && TargetProperty == InTargetProperty;
+	}
+
+	/** Keeps the selected properties but copies nothing. */
+	void Disable();
+
+	void Execute(const void* SourceAddr, void* TargetAddr) const
+	{
+		Kernel(*this, SourceAddr, TargetAddr);
+	}
+
+	const FProperty* SourceProperty = nullptr;
+	const FProperty* TargetProperty = nullptr;
+
+	FKernel Kernel = nullptr;
+
+	/** Number of bytes copied by Memcpy conversions. */
+	int32 Size = 0;
+
+	EScriptableBindingConversion Kind = EScriptableBindingConversion::None;
+};
+
+/** Runtime representation of a FScriptablePropertyBinding. Never serialized. */
+struct FScriptableCompiledBinding
+{
+	/** Sibling the binding reads from, cached at compile time to skip the binding map lookup. */
+	TWeakObjectPtr<UScriptableObject> SourceObject;
+
+	FScriptableBindingPathPlan Source;
+	FScriptableBindingPathPlan Target;
+	FScriptableBindingConversion Conversion;
+
+	/** Version of the source data when it was last copied (0 if never copied). */
+	uint64 CopiedVersion = 0;
+
+	/** Span this binding is copied with, or INDEX_NONE if it is copied on its own. */
+	int32 SpanIndex = INDEX_NONE;
+
+	/** True for the first binding of its span. The span is copied when the resolve reaches it, the other members are skipped. */
+	bool bSpanHead = false;
+};
+
+/**
+ * Several bindings of the same source whose values are laid out back to back, with the same layout, in both the source and the target.
+ * They are copied with a single memcpy.
+ */
+struct FScriptableBindingCopySpan
+{
+	/** Source layout the offsets were computed for. */
+	TWeakObjectPtr<const UStruct> SourceStruct;
+
+	/** Offset of the first byte in the source root memory. */
+	int32 SourceOffset = 0;
+
+	/** Offset of the first byte in the target object. */
+	int32 TargetOffset = 0;
+
+	int32 Size = 0;
+
+	/** Version of the source data when it was last copied (0 if never copied). */
+	uint64 CopiedVersion = 0;
+};
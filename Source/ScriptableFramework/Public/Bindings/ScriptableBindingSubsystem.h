@@ -0,0 +1,94 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/ObjectKey.h"
+#include "ScriptableBindingSubsystem.generated.h"
+
+class UScriptableObject;
+class UScriptableBindingSubsystem;
+
+/** Tick function that resolves the per-tick bindings of every registered object, before they tick. */
+USTRUCT()
+struct FScriptableBindingTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UScriptableBindingSubsystem* Target = nullptr;
+
+	SCRIPTABLEFRAMEWORK_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	SCRIPTABLEFRAMEWORK_API virtual FString DiagnosticMessage() override;
+	SCRIPTABLEFRAMEWORK_API virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptableBindingTickFunction> : public TStructOpsTypeTraitsBase2<FScriptableBindingTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/** Objects with per-tick bindings of one binding depth, in no particular order. */
+USTRUCT()
+struct FScriptableTickBindingDepth
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableObject>> Objects;
+};
+
+/**
+ * Batches the EveryTick / OnChange bindings of all ticking scriptable objects of a world.
+ * Objects are added when their tick function is registered, and their tick depends on this subsystem's tick,
+ * so they always see fresh values without resolving every binding each frame.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableBindingSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitialize() override;
+	virtual void Deinitialize() override;
+
+	/** Starts resolving the tick bindings of the object before each of its ticks. */
+	void AddTickBindings(UScriptableObject* Object);
+
+	/** Stops resolving the tick bindings of the object. */
+	void RemoveTickBindings(UScriptableObject* Object);
+
+	/** Resolves the tick bindings of every registered object. */
+	void ResolveTickBindings();
+
+	/** Makes the tick function run after the tick bindings are resolved, for functions that tick objects on their behalf. */
+	void AddTickPrerequisite(FTickFunction& InTickFunction);
+
+private:
+	FScriptableBindingTickFunction TickFunction;
+
+	/** Objects with at least one per-tick binding and a registered tick function, by binding depth so sibling chains resolve sources first. */
+	UPROPERTY(Transient)
+	TArray<FScriptableTickBindingDepth> Depths;
+
+	struct FSlot
+	{
+		int32 Depth;
+		int32 Index;
+	};
+
+	/** Where each object is in Depths, for constant time adds and removals. */
+	TMap<TObjectKey<UScriptableObject>, FSlot> Slots;
+
+	/** True while resolving. Objects removed meanwhile are only cleared, and compacted afterwards. */
+	bool bResolving = false;
+	bool bNeedsCompact = false;
+
+	/** Drops the objects cleared while resolving and updates the slots of those that moved. */
+	void CompactDepths();
+};
@@ -4,9 +4,30 @@
 
 #include "CoreMinimal.h"
 #include "PropertyBindingPath.h"
+#include "Bindings/ScriptableBindingPlan.h"
+#include "StructUtils/StructView.h"
 #include "ScriptablePropertyBindings.generated.h"
 
 struct FPropertyBindingDataView;
+struct FInstancedPropertyBag;
+struct FScriptableDataVersion;
+
+/** When a binding copies its value into the target. */
+UENUM()
+enum class EScriptableBindingResolvePolicy : uint8
+{
+	/** Copied once when the object begins (or when a condition is checked). */
+	OnBegin,
+
+	/** Also copied before every tick of the object, even if the source did not change. */
+	EveryTick,
+
+	/**
+	 * Also checked before every tick of the object, copied only if the source data version changed.
+	 * Opt in only for read-only inputs: writes to the target, or to the Context without MarkContextChanged, are not seen.
+	 */
+	OnChange
+};
 
 /** Defines a single binding: Copy from SourcePath -> TargetPath */
 USTRUCT()
@@ -25,6 +46,16 @@ struct SCRIPTABLEFRAMEWORK_API FScriptablePropertyBinding
 
 	UPROPERTY()
 	bool bIsAutoBinding = false;
+
+	/**
+	 * When the value is copied. Baked from the "ScriptableResolve" metadata of the target property
+	 * (e.g. meta = (ScriptableResolve = "EveryTick")) when the object is edited or saved.
+	 */
+	UPROPERTY()
+	EScriptableBindingResolvePolicy ResolvePolicy = EScriptableBindingResolvePolicy::OnBegin;
+
+	/** Returns true if the binding is resolved again before each tick. */
+	bool ResolvesOnTick() const { return ResolvePolicy != EScriptableBindingResolvePolicy::OnBegin; }
 };
 
 /** Container for all property bindings of an object. */
@@ -53,16 +84,126 @@ public:
 	 * @return Pointer to the source path if found, nullptr otherwise.
 	 */
 	const FPropertyBindingPath* GetPropertyBinding(const FPropertyBindingPath& TargetPath) const;
+
+	/** Applies the "ScriptableResolve" metadata of the target properties to the bindings. Returns true if any policy changed. */
+	bool BakeResolvePolicies(const class UScriptableObject* TargetObject);
 #endif
 
 	/**
 	 * Resolves all bindings and copies values to the TargetObject.
 	 * Handles both Context bindings and Task-to-Task bindings.
+	 * Every value is copied, even if its source did not change.
 	 */
 	void ResolveBindings(class UScriptableObject* TargetObject);
 
+	/**
+	 * Resolves only the bindings with an EveryTick or OnChange policy. Called before the object ticks.
+	 * OnChange values whose source was not written since the last copy are skipped (see FScriptableDataVersion).
+	 */
+	void ResolveTickBindings(class UScriptableObject* TargetObject);
+
+	/** Returns true if any binding needs to be resolved before each tick. */
+	bool HasTickBindings() const;
+
+	/**
+	 * Compiles every binding against the current Context layout and binding sources of TargetObject.
+	 * Called on registration so ResolveBindings only walks cached properties and offsets.
+	 * Bindings whose source is not available yet are compiled lazily on resolve.
+	 */
+	void CompileBindings(class UScriptableObject* TargetObject);
+
+	/**
+	 * Resets every FScriptablePropertyRef bound by reference. Called when the object unregisters,
+	 * as the referenced Context and siblings are only guaranteed to live while the object is registered.
+	 */
+	void ReleaseReferences(class UScriptableObject* TargetObject);
+
+	/**
+	 * Counterparts of CompileBindings, ResolveBindings and ReleaseReferences for struct nodes (see FScriptableNode),
+	 * whose memory is the target. Nodes are not binding sources, so only Context bindings are resolved.
+	 */
+	void CompileBindings(FStructView TargetNode, const FInstancedPropertyBag* Context);
+	void ResolveBindings(FStructView TargetNode, const FInstancedPropertyBag* Context, const FScriptableDataVersion* ContextVersion);
+	void ReleaseReferences(FStructView TargetNode);
+
+	/** What the bindings are compiled and resolved against: the target memory, the Context and the object owning them, if any. */
+	struct FResolveScope;
+
+	/** Drops all compiled plans. They will be rebuilt on the next compile or resolve. */
+	void ResetCompiledBindings() { CompiledBindings.Reset(); CopySpans.Reset(); }
+
+	/** Rebuilds the editor lookup index after loading or undo/redo. */
+	void PostSerialize(const FArchive& Ar);
+
 	UPROPERTY()
 	TArray<FScriptablePropertyBinding> Bindings;
 
-	void CopySingleBinding(const FScriptablePropertyBinding& Binding, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView);
+private:
+#if WITH_EDITOR
+	/** Returns the index of the binding with exactly this target path, or INDEX_NONE. */
+	int32 FindBindingIndex(const FPropertyBindingPath& TargetPath) const;
+
+	/** Collects the indices of the bindings whose target path is nested below TargetPath. */
+	void FindChildBindings(const FPropertyBindingPath& TargetPath, TArray<int32, TInlineAllocator<8>>& OutIndices) const;
+
+	/** Rebuilds the index if it was invalidated or if Bindings was modified from outside. */
+	void EnsureTargetPathIndex() const;
+
+	/** Adds a single binding to a valid index. */
+	void IndexBinding(int32 BindingIndex) const;
+
+	/** Call after removing bindings or editing target paths in place. */
+	void InvalidateTargetPathIndex() { bTargetPathIndexValid = false; }
+#endif
+
+#if WITH_EDITORONLY_DATA
+	/** Binding indices by the hash of their target path. Keeps editor lookups constant time on large objects. */
+	mutable TMultiMap<uint32, int32> TargetPathIndex;
+
+	/** Binding indices by the hash of every parent of their target path, used to find the bindings nested below a path. */
+	mutable TMultiMap<uint32, int32> TargetPrefixIndex;
+
+	/** Number of bindings the index was built for. */
+	mutable int32 IndexedNum = 0;
+
+	mutable bool bTargetPathIndexValid = false;
+#endif
+
+	/** Runtime plans, parallel to Bindings. Never serialized. */
+	TArray<FScriptableCompiledBinding> CompiledBindings;
+
+	/** Runs of contiguous POD bindings copied with a single memcpy. Built by CompileBindings. */
+	TArray<FScriptableBindingCopySpan> CopySpans;
+
+	/** Shared implementations of the object and struct node entry points. */
+	void CompileBindingsInternal(const FResolveScope& Scope);
+	void ResolveBindingsInternal(const FResolveScope& Scope, bool bTickOnly);
+	void ReleaseReferencesInternal(const FPropertyBindingDataView& TargetView);
+
+	/** Merges compiled bindings that are contiguous in both their source and target into copy spans. */
+	void BuildCopySpans();
+
+	/** Splits every span back into individual bindings. */
+	void ResetCopySpans();
+
+	/** Copies a whole span. Returns false if the source layout changed and the span can no longer be used. */
+	bool CopySpan(FScriptableBindingCopySpan& Span, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView, uint64 SourceVersion);
+
+	/**
+	 * Returns the data view a binding copies from, or an invalid view if the source is not available.
+	 * @param OutSourceVersion If set, receives the change stamp of the source data (0 if it is not versioned).
+	 */
+	static FPropertyBindingDataView GetSourceView(const FScriptablePropertyBinding& Binding, FScriptableCompiledBinding& Compiled, const FResolveScope& Scope, uint64* OutSourceVersion = nullptr);
+
+	/** Copies a single binding. Skipped if SourceVersion is the version that was copied last time. */
+	void CopyBinding(const FScriptablePropertyBinding& Binding, FScriptableCompiledBinding& Compiled, const FPropertyBindingDataView& SrcView, const FPropertyBindingDataView& DestView, uint64 SourceVersion = 0);
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptablePropertyBindings> : public TStructOpsTypeTraitsBase2<FScriptablePropertyBindings>
+{
+	enum
+	{
+		WithPostSerialize = true
+	};
 };
\ No newline at end of file
@@ -0,0 +1,65 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptablePropertyRef.generated.h"
+
+/**
+ * Read-only reference to a bound value, used instead of a copy for large structs, arrays and strings.
+ * Declare it as a bindable input and name the referenced type in the "RefType" metadata:
+ *
+ *	UPROPERTY(EditAnywhere, Category = "Input", meta = (RefType = "TArray<AActor*>"))
+ *	FScriptablePropertyRef Targets;
+ *
+ *	if (const TArray<AActor*>* Actors = Targets.Get<TArray<AActor*>>()) { ... }
+ *
+ * Lifetime: the reference is set when the binding resolves and points straight into the source memory
+ * (the container Context or the bound sibling). It stays valid while the object is registered with its container,
+ * and is refreshed on each resolve, so it also follows a Context that was rebuilt since the last resolve.
+ * It is reset when the object unregisters. Never keep the pointer returned by Get() across frames.
+ */
+USTRUCT(BlueprintType)
+struct SCRIPTABLEFRAMEWORK_API FScriptablePropertyRef
+{
+	GENERATED_BODY()
+
+	/** Returns true if the reference points to a value. */
+	bool IsValid() const { return Memory != nullptr; }
+
+	/** Property describing the referenced value. */
+	const FProperty* GetProperty() const { return Property; }
+
+	/** Address of the referenced value. */
+	const void* GetMemory() const { return Memory; }
+
+	/** Returns the referenced value as T, or nullptr if the reference is not set. T must match the "RefType" metadata. */
+	template<typename T>
+	const T* Get() const
+	{
+		checkSlow(!Property || Property->GetElementSize() == sizeof(T));
+		return static_cast<const T*>(Memory);
+	}
+
+	/** Points the reference to a value. Called by the binding system. */
+	void Set(const FProperty* InProperty, const void* InMemory)
+	{
+		Property = InProperty;
+		Memory = InMemory;
+	}
+
+	void Reset() { Set(nullptr, nullptr); }
+
+	/**
+	 * Returns true if a value of SourceProperty can be referenced by RefProperty.
+	 * Compares the source type with the "RefType" metadata of RefProperty. A reference without metadata accepts any type.
+	 */
+	static bool CanReference(const FProperty* RefProperty, const FProperty* SourceProperty);
+
+	/** Returns true if the property is a FScriptablePropertyRef. */
+	static bool IsRefProperty(const FProperty* Property);
+
+private:
+	const FProperty* Property = nullptr;
+	const void* Memory = nullptr;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableObject.h"
+#include "ScriptableConditions/ScriptableInvalidationSources.h"
 #include "ScriptableCondition.generated.h"
 
 UCLASS(Abstract, DefaultToInstanced, EditInlineNew, Blueprintable, BlueprintType, HideCategories = (Hidden, Tick), CollapseCategories)
@@ -15,8 +16,66 @@ protected:
 	UPROPERTY(EditAnywhere, Category = Hidden, meta = (NoBinding))
 	uint8 bNegate : 1 = 0;
 
+	/**
+	 * If true, requirements that reorder their conditions never move other conditions across this one.
+	 * Set it on conditions with side effects, or whose result depends on what was evaluated before them.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Condition", AdvancedDisplay, meta = (NoBinding))
+	uint8 bOrderSensitive : 1 = 0;
+
+	/**
+	 * If false, requirements that cache their result never do it while they contain this condition.
+	 * Clear it on conditions whose result can change between two checks with the same Context in the same frame.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Condition", AdvancedDisplay, meta = (NoBinding))
+	uint8 bCacheable : 1 = 1;
+
+	/**
+	 * If true, the condition calls NotifyResultChanged whenever its result may change (e.g. from an event it listens to),
+	 * so requirements in watch mode only re-evaluate it then, or when the Context properties it is bound to change.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category = "Condition", AdvancedDisplay, meta = (NoBinding))
+	uint8 bNotifiesChanges : 1 = 0;
+
 public:
 	FORCEINLINE bool IsNegated() const { return bNegate; }
+	FORCEINLINE void SetNegated(bool bInNegate) { bNegate = bInNegate; }
+
+	/** Returns true if the condition must be evaluated in its authored position. */
+	virtual bool IsOrderSensitive() const { return bOrderSensitive; }
+
+	/** Returns true if the result can be reused for the rest of the frame while the Context does not change. */
+	virtual bool IsCacheable() const { return bCacheable; }
+
+	/**
+	 * Returns true if Evaluate only reads the properties of the condition (and objects the game thread doesn't write meanwhile),
+	 * so a copy can be evaluated on a worker thread (see FScriptableRequirement::EvaluateAsync).
+	 * Override it in native classes. Blueprint classes are never evaluated off the game thread.
+	 */
+	virtual bool IsThreadSafe() const { return false; }
+
+	/** Returns true if the condition is thread-safe and native. */
+	bool CanEvaluateOffGameThread() const { return IsThreadSafe() && GetClass()->HasAnyClassFlags(CLASS_Native); }
+
+	/**
+	 * Returns true if the condition can be evaluated without being registered (see FScriptableRequirement::EvaluateStateless).
+	 * Its owner, Context and bindings are set then, but OnRegister is not called and GetWorld comes from the owner.
+	 * Override it to return false in classes that set up state in OnRegister.
+	 */
+	virtual bool SupportsStatelessEvaluation() const { return true; }
+
+	/**
+	 * Declares the events after which the result of this condition may change, for requirements in watch mode
+	 * (see FScriptableRequirement::StartWatching). Called after the condition resolved its bindings.
+	 * @return False if the result can also change without any declared source firing.
+	 * The default declares the bound Context properties if bNotifiesChanges is set, and returns false otherwise.
+	 * Conditions whose result only depends on their own properties can return DeclareBoundContextProperties(Sources).
+	 */
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const;
+
+	/** Re-evaluates the requirements watching this condition. Only needed on conditions with bNotifiesChanges. */
+	UFUNCTION(BlueprintCallable, Category = ScriptableCondition)
+	void NotifyResultChanged() { OnResultChanged.Broadcast(); }
 
 	/** Conditions should typically be instant checks, not ticking objects. */
 	virtual bool CanEverTick() const final override { return false; }
@@ -27,6 +86,12 @@ public:
 	 */
 	bool CheckCondition();
 
+	/**
+	 * Evaluates a copy whose bindings were resolved when it was taken, without resolving them again.
+	 * Can run on a worker thread if the condition is thread-safe. Handles Negation.
+	 */
+	bool CheckSnapshot() const;
+
 protected:
 	/**
 	 * Implementation of the specific condition check.
@@ -35,6 +100,15 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = ScriptableCondition)
 	bool Evaluate() const;
 
+	/**
+	 * Declares the Context properties this condition is bound to.
+	 * @return False if some binding reads anything else (a sibling, or a value nested in a Context property).
+	 */
+	bool DeclareBoundContextProperties(FScriptableInvalidationSources& Sources) const;
+
 private:
 	virtual bool Evaluate_Implementation() const { return false; }
+
+	/** Broadcast by NotifyResultChanged. */
+	mutable FSimpleMulticastDelegate OnResultChanged;
 };
\ No newline at end of file
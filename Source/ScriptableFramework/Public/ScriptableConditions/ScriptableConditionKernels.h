@@ -0,0 +1,33 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class EScriptableComparisonOp : uint8;
+
+/**
+ * Vectorized forms of the built-in comparison conditions, evaluated over columns of values (one row per owner).
+ * They use the VectorRegister4Double abstraction, so they compile to SSE/AVX2 or NEON depending on the platform.
+ * Results are written one bit per row into OutResults, which is resized to the number of rows.
+ * Columns passed together must have the same number of rows.
+ */
+namespace ScriptableConditionKernels
+{
+	/** A[i] <op> B[i]. Equal and NotEqual use Tolerance, as UScriptableCondition_CompareNumbers does. */
+	SCRIPTABLEFRAMEWORK_API void CompareNumbers(TConstArrayView<double> A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults);
+	SCRIPTABLEFRAMEWORK_API void CompareNumbers(TConstArrayView<double> A, double B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults);
+	SCRIPTABLEFRAMEWORK_API void CompareNumbers(double A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults);
+
+	/**
+	 * Distance(Origins[i], Targets[i]) <op> Distance, compared squared as UScriptableCondition_Distance does.
+	 * Squared distances are computed in double precision, so a row within float rounding of the threshold
+	 * may differ from the per-owner condition, which measures it in float.
+	 */
+	SCRIPTABLEFRAMEWORK_API void CompareDistances(TConstArrayView<FVector> Origins, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults);
+	SCRIPTABLEFRAMEWORK_API void CompareDistances(const FVector& Origin, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults);
+
+	/** One row at a time versions of the kernels, with the same results. Reference for tests and benchmarks. */
+	SCRIPTABLEFRAMEWORK_API void CompareNumbersScalar(TConstArrayView<double> A, TConstArrayView<double> B, EScriptableComparisonOp Operation, double Tolerance, TBitArray<>& OutResults);
+	SCRIPTABLEFRAMEWORK_API void CompareDistancesScalar(TConstArrayView<FVector> Origins, TConstArrayView<FVector> Targets, EScriptableComparisonOp Operation, float Distance, TBitArray<>& OutResults);
+}
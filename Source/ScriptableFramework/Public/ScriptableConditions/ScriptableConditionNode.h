@@ -0,0 +1,62 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptableNode.h"
+#include "ScriptableConditions/ScriptableCondition_Compare.h"
+#include "ScriptableConditionNode.generated.h"
+
+/**
+ * Base of the struct conditions, stored inline in FScriptableRequirement::ConditionNodes.
+ * The inline counterpart of UScriptableCondition: no Blueprint subclasses, no tick, no invalidation sources.
+ */
+USTRUCT(meta = (Hidden))
+struct SCRIPTABLEFRAMEWORK_API FScriptableConditionNode : public FScriptableNode
+{
+	GENERATED_BODY()
+
+public:
+	FORCEINLINE bool IsNegated() const { return bNegate; }
+	FORCEINLINE void SetNegated(bool bInNegate) { bNegate = bInNegate; }
+
+	/** Returns true if the result only depends on the Context and the bound values, so it can be cached by the requirement. */
+	virtual bool IsCacheable() const { return true; }
+
+	/** Resolves the bindings, evaluates and applies the negation. */
+	bool CheckCondition();
+
+protected:
+	virtual bool Evaluate() const { return true; }
+
+	/** If true, the result of the evaluation is inverted. */
+	UPROPERTY(EditAnywhere, Category = "Node", meta = (NoBinding))
+	uint8 bNegate : 1 = false;
+};
+
+/** Struct version of UScriptableCondition_CompareNumbers. */
+USTRUCT(DisplayName = "Compare Numbers (Node)", meta = (ConditionCategory = "System|Math"))
+struct SCRIPTABLEFRAMEWORK_API FScriptableConditionNode_CompareNumbers : public FScriptableConditionNode
+{
+	GENERATED_BODY()
+
+public:
+	/** The first value to compare */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	double A = 0.0;
+
+	/** The second value to compare */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	double B = 0.0;
+
+	/** The comparison operator */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	EScriptableComparisonOp Operation = EScriptableComparisonOp::Equal;
+
+	/** Error tolerance for float equality checks. Only used for == and != */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "Operation == EScriptableComparisonOp::Equal || Operation == EScriptableComparisonOp::NotEqual", EditConditionHides))
+	double ErrorTolerance = 1.e-4;
+
+protected:
+	virtual bool Evaluate() const override;
+};
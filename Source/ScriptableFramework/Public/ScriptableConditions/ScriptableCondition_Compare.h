@@ -40,6 +40,19 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "Operation == EScriptableComparisonOp::Equal || Operation == EScriptableComparisonOp::NotEqual", EditConditionHides))
 	double ErrorTolerance = 1.e-4;
 
+	/**
+	 * Evaluates the condition for many owners at once through the vector kernels (see ScriptableConditionKernels),
+	 * with its operator, tolerance and negation. Bindings are not resolved, the values come from the columns.
+	 * @param ValuesA One A per owner, or empty to use A for every owner.
+	 * @param ValuesB One B per owner, or empty to use B for every owner.
+	 * @param OutResults Receives one bit per owner.
+	 */
+	void EvaluateBatch(TConstArrayView<double> ValuesA, TConstArrayView<double> ValuesB, TBitArray<>& OutResults) const;
+
+	virtual bool IsThreadSafe() const override { return true; }
+
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override { return DeclareBoundContextProperties(Sources); }
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -71,6 +84,15 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config")
 	float Distance = 500.0f;
 
+	/**
+	 * Evaluates the condition for many owners at once through the vector kernels (see ScriptableConditionKernels),
+	 * with its operator, distance and negation. Bindings are not resolved, the locations come from the columns.
+	 * @param OriginLocations One origin per owner, or empty to use the location of Origin for every owner.
+	 * @param TargetLocations One target per owner.
+	 * @param OutResults Receives one bit per owner.
+	 */
+	void EvaluateBatch(TConstArrayView<FVector> OriginLocations, TConstArrayView<FVector> TargetLocations, TBitArray<>& OutResults) const;
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
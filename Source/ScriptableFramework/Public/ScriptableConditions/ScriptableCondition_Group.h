@@ -29,6 +29,12 @@ public:
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
 
+	virtual bool IsOrderSensitive() const override { return Super::IsOrderSensitive() || Requirement.IsOrderSensitive(); }
+	virtual bool IsCacheable() const override { return Super::IsCacheable() && Requirement.IsCacheable(); }
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override { return Requirement.DeclareInvalidationSources(Sources); }
+	virtual bool IsThreadSafe() const override { return Requirement.IsThreadSafe(); }
+	virtual bool SupportsStatelessEvaluation() const override { return Requirement.SupportsStatelessEvaluation(); }
+
 protected:
 	virtual bool Evaluate_Implementation() const override;
 };
\ No newline at end of file
@@ -28,6 +28,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config")
 	bool bValue = true;
 
+	virtual bool IsThreadSafe() const override { return true; }
+
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override { return DeclareBoundContextProperties(Sources); }
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -55,6 +59,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config")
 	EScriptableBoolOp Operation = EScriptableBoolOp::And;
 
+	virtual bool IsThreadSafe() const override { return true; }
+
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override { return DeclareBoundContextProperties(Sources); }
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -77,6 +85,12 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0, ClampMax = 1, UIMin = 0, UIMax = 1))
 	float Chance = 0.5f;
 
+	/** Each evaluation consumes a random number, so skipping or adding evaluations changes the sequence. */
+	virtual bool IsOrderSensitive() const override { return true; }
+
+	/** Rolls again on every check. */
+	virtual bool IsCacheable() const override { return false; }
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -96,6 +110,12 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (ScriptableContext))
 	TObjectPtr<UObject> TargetObject = nullptr;
 
+	/** Only reads the object flags. The pooled copy evaluated asynchronously keeps the object referenced. */
+	virtual bool IsThreadSafe() const override { return true; }
+
+	/** Context bindings, and the destruction of the object if it is an actor. */
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override;
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -0,0 +1,85 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptableCondition.h"
+#include "ScriptableCondition_Compare.h"
+#include "ScriptableCondition_Proximity.generated.h"
+
+class UScriptableSpatialSubsystem;
+
+/**
+ * Base of the conditions looking for the actors of a group around an origin actor.
+ * Queries the spatial hash of UScriptableSpatialSubsystem, so only actors registered there are seen,
+ * and the cost depends on how many are near the origin rather than on how many exist.
+ */
+UCLASS(Abstract)
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_ProximityBase : public UScriptableCondition
+{
+	GENERATED_BODY()
+
+public:
+	/** The actor at the center of the query. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	TObjectPtr<AActor> Origin = nullptr;
+
+	/** The group the actors were registered in (see UScriptableSpatialSubsystem::RegisterActor). */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	FName Group;
+
+	/** The radius of the query. */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0))
+	float Radius = 500.0f;
+
+	/** If true, the origin is not counted when it is registered in the same group. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	bool bIgnoreOrigin = true;
+
+protected:
+	/** Number of actors of the group within the radius, stopping at MaxCount. Zero if there is no origin. */
+	int32 CountActors(int32 MaxCount) const;
+
+#if WITH_EDITOR
+	/** "{Group} within {Radius} of {Origin}", with binding names instead of values where bound. */
+	FText GetQueryText() const;
+#endif
+};
+
+/** Checks if any actor of a group is within a radius of an actor. */
+UCLASS(DisplayName = "Any Actor In Radius", meta = (ConditionCategory = "System|Spatial"))
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_AnyActorInRadius : public UScriptableCondition_ProximityBase
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual FText GetDisplayTitle() const override;
+#endif
+
+protected:
+	virtual bool Evaluate_Implementation() const override;
+};
+
+/** Compares the number of actors of a group within a radius of an actor. */
+UCLASS(DisplayName = "Count Actors In Radius", meta = (ConditionCategory = "System|Spatial"))
+class SCRIPTABLEFRAMEWORK_API UScriptableCondition_CountActorsInRadius : public UScriptableCondition_ProximityBase
+{
+	GENERATED_BODY()
+
+public:
+	/** The comparison operator (e.g., <, >, ==). */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	EScriptableComparisonOp Operation = EScriptableComparisonOp::GreaterOrEqual;
+
+	/** The number of actors to compare against. */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0))
+	int32 Count = 1;
+
+#if WITH_EDITOR
+	virtual FText GetDisplayTitle() const override;
+#endif
+
+protected:
+	virtual bool Evaluate_Implementation() const override;
+};
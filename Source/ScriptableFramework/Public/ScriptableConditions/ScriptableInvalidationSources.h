@@ -0,0 +1,119 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "StructUtils/PropertyBag.h"
+#include "ScriptableInvalidationSources.generated.h"
+
+class AActor;
+
+/** A Context watched by a FScriptableInvalidationSources. */
+USTRUCT()
+struct FScriptableWatchedContext
+{
+	GENERATED_BODY()
+
+	const FInstancedPropertyBag* Context = nullptr;
+
+	/** Copy of the Context when it was last compared. */
+	UPROPERTY()
+	FInstancedPropertyBag Snapshot;
+
+	/** Watched properties, from the layout of the snapshot. If the Context is rebuilt with another layout, they all count as changed. */
+	TArray<const FProperty*, TInlineAllocator<4>> Properties;
+};
+
+/** Object side of a FScriptableInvalidationSources: keeps the snapshots visible to the garbage collector and receives dynamic delegates. */
+UCLASS(Transient, MinimalAPI)
+class UScriptableInvalidationListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<FScriptableWatchedContext> Contexts;
+
+	FSimpleDelegate OnInvalidated;
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* DestroyedActor);
+};
+
+/**
+ * Events after which the result of a watched requirement may change (see FScriptableRequirement::StartWatching).
+ * Filled by UScriptableCondition::DeclareInvalidationSources, every source calls the same delegate when it fires.
+ * Subscriptions last until Reset. Game thread only.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableInvalidationSources
+{
+	FScriptableInvalidationSources() = default;
+	~FScriptableInvalidationSources() { Reset(); }
+
+	/** Copies don't watch anything, the subscriptions refer to the requirement they were made for. */
+	FScriptableInvalidationSources(const FScriptableInvalidationSources&) {}
+	FScriptableInvalidationSources& operator=(const FScriptableInvalidationSources&) { return *this; }
+
+	/** Sets the delegate called when any source fires. */
+	void SetCallback(FSimpleDelegate InOnInvalidated);
+
+	/**
+	 * The result may change when this property of the Context changes.
+	 * Checked on every FScriptableContainer::MarkContextChanged of the container owning the bag, and compared by value,
+	 * so writes to other properties or of the same value don't fire.
+	 */
+	void AddContextProperty(const FInstancedPropertyBag& Context, FName PropertyName);
+
+	/** The result may change when the actor is destroyed. */
+	void AddActorDestroyed(AActor* Actor);
+
+	/**
+	 * The result may change when a custom event fires (e.g. a gameplay tag count change).
+	 * Subscribe must bind the delegate it receives to the event, and return the function that unbinds it.
+	 */
+	void AddCustom(TFunctionRef<TFunction<void()>(const FSimpleDelegate&)> Subscribe);
+
+	/** Unsubscribes from every event and forgets the watched properties. */
+	void Reset();
+
+	bool IsEmpty() const { return (!Listener || Listener->Contexts.IsEmpty()) && Actors.IsEmpty() && Unsubscribers.IsEmpty(); }
+
+	/** Called by FScriptableContainer::MarkContextChanged. Cheap when nothing watches a Context. */
+	static void NotifyContextChanged(const FInstancedPropertyBag& Context)
+	{
+		if (NumWatchedContexts > 0)
+		{
+			NotifyContextChangedInternal(Context);
+		}
+	}
+
+	/** Drops context notifications while in scope. Used when a Context is temporarily overwritten (e.g. batch evaluation). */
+	struct FSuspendContextScope
+	{
+		FSuspendContextScope() { ++SuspendCount; }
+		~FSuspendContextScope() { --SuspendCount; }
+		UE_NONCOPYABLE(FSuspendContextScope);
+	};
+
+private:
+	UScriptableInvalidationListener& GetListener();
+
+	/** Compares the watched properties of the Context against the snapshot, takes the new values and fires if any changed. */
+	void HandleContextChanged(const FInstancedPropertyBag& Context);
+
+	static void NotifyContextChangedInternal(const FInstancedPropertyBag& Context);
+
+	FSimpleDelegate OnInvalidated;
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<TFunction<void()>> Unsubscribers;
+
+	/** Created on the first Context or actor source. */
+	TStrongObjectPtr<UScriptableInvalidationListener> Listener;
+
+	/** Number of Contexts watched by any instance. */
+	static int32 NumWatchedContexts;
+
+	static int32 SuspendCount;
+};
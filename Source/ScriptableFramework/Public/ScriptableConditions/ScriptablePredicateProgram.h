@@ -0,0 +1,157 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FScriptableRequirement;
+struct FScriptableContextTable;
+struct FInstancedPropertyBag;
+class UScriptableCondition;
+
+/** Instruction of a compiled requirement. */
+enum class EScriptablePredicateOp : uint8
+{
+	/** Evaluates the children that follow, up to End, with And/Or short-circuit. */
+	Group,
+
+	/** UScriptableCondition_Bool: Operand 0. */
+	Bool,
+
+	/** UScriptableCondition_CompareNumbers: Operand 0 <op> Operand 1, Operand 2 is the tolerance. */
+	CompareNumbers,
+
+	/** UScriptableCondition_CompareBooleans: Operand 0 <op> Operand 1. */
+	CompareBooleans,
+
+	/** UScriptableCondition_IsValid: Operand 0. */
+	IsValid,
+
+	/** UScriptableCondition_Distance: distance between Operand 0 and Operand 1 <op> Operand 2. */
+	Distance,
+
+	/** Any other condition, evaluated through UScriptableCondition::CheckCondition. */
+	CallOut
+};
+
+/** How an operand is read from memory. */
+enum class EScriptablePredicateLoad : uint8
+{
+	Bool,
+	Float,
+	Double,
+	Int32,
+	Int64,
+	UInt8,
+	Object
+};
+
+/** A value read straight from the memory of a Context bag or of the condition itself. */
+struct FScriptablePredicateOperand
+{
+	/** Index of the memory base (see FScriptablePredicateProgram::Bases). */
+	int32 BaseIndex = 0;
+
+	/** Byte offset of the value from the base. */
+	int32 Offset = 0;
+
+	/** Bytes between two rows when the base is a context table column, 0 otherwise. */
+	int32 Stride = 0;
+
+	/** Mask of the bit read by Bool loads (0xFF for native bools). */
+	uint8 FieldMask = 0xFF;
+
+	EScriptablePredicateLoad Load = EScriptablePredicateLoad::Double;
+};
+
+struct FScriptablePredicateInstruction
+{
+	EScriptablePredicateOp Op = EScriptablePredicateOp::CallOut;
+
+	/** EScriptableComparisonOp, EScriptableBoolOp or EScriptableRequirementMode, depending on Op. */
+	uint8 Operation = 0;
+
+	/** Result is inverted. Combines the condition and requirement negation of groups. */
+	bool bNegate = false;
+
+	/** Index of the first operand. */
+	int32 FirstOperand = 0;
+
+	/** Group only: index of the first instruction after the group. */
+	int32 End = 0;
+
+	/** CallOut only. Kept alive by the requirement that owns the program. */
+	UScriptableCondition* Condition = nullptr;
+};
+
+/**
+ * Flat form of a FScriptableRequirement and its nested groups, evaluated without going through
+ * UScriptableCondition::CheckCondition for the built-in conditions.
+ * Their operands are read from the condition itself when unbound, or from the Context when bound to a plain Context property,
+ * so the program does not resolve the bindings of lowered conditions (their properties keep the values of the last CheckCondition).
+ * Conditions that can't be lowered (Blueprint or project conditions, bindings to siblings or getters, sources of sibling bindings) are called out.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptablePredicateProgram
+{
+	/** Compiles the conditions of a registered requirement. */
+	void Compile(const FScriptableRequirement& Requirement);
+
+	void Reset();
+
+	/** Returns true if the program was compiled and the Context layouts it reads from did not change since. */
+	bool IsUpToDate() const;
+
+	/** Runs the program. Must be up to date. */
+	bool Execute() const;
+
+	/**
+	 * Makes the operands read from the Context of the requirement read from the columns of the table instead.
+	 * The table must have the layout of that Context. Returns false if an operand could not be mapped.
+	 */
+	bool BindContextTable(const FScriptableRequirement& Requirement, const FScriptableContextTable& Table);
+
+	/**
+	 * Runs the program once per row of the bound table and writes the results into OutResults.
+	 * Without call-outs, chunks of rows run in parallel, or through the vector kernels when the program is a single
+	 * number or distance comparison. Otherwise every row runs on this thread, after copying it into
+	 * the Context of the requirement so the called out conditions resolve their bindings against it.
+	 */
+	void ExecuteBatch(const FScriptableContextTable& Table, FScriptableRequirement& Requirement, TBitArray<>& OutResults) const;
+
+	bool IsCompiled() const { return bCompiled; }
+
+	int32 NumInstructions() const { return Instructions.Num(); }
+
+	/** Number of conditions that are evaluated through CheckCondition. */
+	int32 NumCallOuts() const;
+
+private:
+	/** Memory operands are read from. Bags are re-read on each execution, as their memory moves when the layout is migrated. */
+	struct FBase
+	{
+		const FInstancedPropertyBag* Bag = nullptr;
+		const UStruct* BagStruct = nullptr;
+		const uint8* Memory = nullptr;
+	};
+
+	/** BoundSourceIDs are the binding IDs of the conditions that other conditions bind to, which are always called out. */
+	void CompileRequirement(const FScriptableRequirement& Requirement, bool bConditionNegated, const TSet<FGuid>& BoundSourceIDs);
+	void CompileCondition(UScriptableCondition* Condition, const TSet<FGuid>& BoundSourceIDs);
+
+	/** Kind is the kind of value (number, bool, object) the instruction expects. */
+	bool CompileOperand(UScriptableCondition* Condition, FName PropertyName, uint8 Kind, const UClass* RequiredClass, FScriptablePredicateOperand& OutOperand);
+	int32 AddBase(const FInstancedPropertyBag* Bag, const UObject* Object);
+
+	bool ExecuteAt(int32& InOutIndex, const uint8* const* BaseMemory, int32 Row = 0) const;
+
+	/** Runs a program made of a single number or distance comparison through ScriptableConditionKernels. Returns false if it can't. */
+	bool ExecuteBatchVectorized(const uint8* const* BaseMemory, int32 NumRows, TBitArray<>& OutResults) const;
+
+	void GetBaseMemory(TArray<const uint8*, TInlineAllocator<8>>& OutBaseMemory) const;
+
+	TArray<FScriptablePredicateInstruction> Instructions;
+	TArray<FScriptablePredicateOperand> Operands;
+	TArray<FBase> Bases;
+
+	bool bCompiled = false;
+};
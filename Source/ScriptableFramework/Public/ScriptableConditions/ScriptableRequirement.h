@@ -4,10 +4,21 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableContainer.h"
+#include "ScriptableConditions/ScriptablePredicateProgram.h"
+#include "StructUtils/InstancedStruct.h"
+#include "Tasks/Task.h"
 #include "ScriptableRequirement.generated.h"
 
 class UScriptableCondition;
 class UScriptableObject;
+class UScriptableRequirementAsset;
+struct FScriptableContextTable;
+
+/** Receives the result of FScriptableRequirement::EvaluateAsync, on the game thread. */
+DECLARE_DELEGATE_OneParam(FOnScriptableRequirementEvaluated, bool /*bResult*/);
+
+/** Broadcast by a watched requirement when its result changes. */
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnScriptableRequirementResultChanged, bool /*bResult*/);
 
 /** Logical operation for the requirement group. */
 UENUM(BlueprintType)
@@ -17,6 +28,26 @@ enum class EScriptableRequirementMode : uint8
 	Or
 };
 
+/** Runtime statistics of a condition inside a requirement. */
+struct FScriptableConditionStats
+{
+	/** Moving average of the evaluation cost, in cycles. */
+	double AverageCycles = 0.0;
+
+	/** Moving average of the fraction of evaluations that passed. */
+	double PassRate = 0.5;
+
+	uint32 NumEvaluations = 0;
+
+	void AddSample(uint64 Cycles, bool bPassed)
+	{
+		// Plain average for the first samples, then an exponential one that follows changes in the game state
+		const double Alpha = 1.0 / FMath::Min<uint32>(++NumEvaluations, 16);
+		AverageCycles += (double(Cycles) - AverageCycles) * Alpha;
+		PassRate += ((bPassed ? 1.0 : 0.0) - PassRate) * Alpha;
+	}
+};
+
 /** A container for a list of conditions with a logic operation (AND/OR). */
 USTRUCT(BlueprintType)
 struct SCRIPTABLEFRAMEWORK_API FScriptableRequirement : public FScriptableContainer
@@ -34,10 +65,100 @@ public:
 	UPROPERTY(EditAnywhere, Instanced, Category = "Conditions")
 	TArray<TObjectPtr<UScriptableCondition>> Conditions;
 
+	/**
+	 * Struct conditions (see FScriptableConditionNode), stored inline and copied with the requirement.
+	 * Evaluated after Conditions, with the same mode, when these did not decide the result.
+	 * Requirements with condition nodes are not compiled into a program, nor evaluated off the game thread.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Conditions", meta = (BaseStruct = "/Script/ScriptableFramework.ScriptableConditionNode", ExcludeBaseStruct))
+	TArray<FInstancedStruct> ConditionNodes;
+
+	/**
+	 * If true, the conditions are compiled into a flat program on first evaluation (see FScriptablePredicateProgram).
+	 * Built-in conditions are then evaluated in place, without resolving their bindings or calling Evaluate.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Logic", AdvancedDisplay)
+	uint8 bCompileConditions : 1 = false;
+
+	/**
+	 * If true, the cost and pass rate of each condition are measured, and the conditions are evaluated
+	 * cheapest and most likely to decide the result first. Order sensitive conditions keep their position.
+	 * Compiled requirements keep the authored order.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Logic", AdvancedDisplay)
+	uint8 bReorderConditions : 1 = false;
+
+	/**
+	 * If true, the result is reused by later evaluations in the same frame, until the Context changes or Invalidate is called.
+	 * Ignored if any condition is not cacheable (e.g. Probability).
+	 */
+	UPROPERTY(EditAnywhere, Category = "Logic", AdvancedDisplay)
+	uint8 bCacheResult : 1 = false;
+
+	/** Broadcast by a watched requirement when its result changes (see StartWatching). */
+	FOnScriptableRequirementResultChanged OnResultChanged;
+
 private:
 	UPROPERTY(Transient)
 	uint8 bIsRegistered : 1 = false;
 
+	/** Compiled form of the conditions. Built lazily while registered. */
+	mutable FScriptablePredicateProgram Program;
+
+	/** Statistics of each condition, parallel to Conditions. Kept across registrations. */
+	mutable TArray<FScriptableConditionStats> ConditionStats;
+
+	/** Indices of the conditions in evaluation order. */
+	mutable TArray<int32> EvaluationOrder;
+
+	mutable int32 EvaluationsSinceReorder = 0;
+
+	/** Frame of the cached result (MAX_uint64 if there is none). */
+	mutable uint64 CachedFrame = MAX_uint64;
+
+	/** Context version the cached result was computed with. */
+	mutable uint64 CachedContextVersion = 0;
+
+	mutable bool bCachedResult = false;
+
+	/** True if every condition is cacheable. Updated on registration. */
+	bool bConditionsCacheable = false;
+
+	/** Events the conditions depend on, while watching. */
+	FScriptableInvalidationSources WatchSources;
+
+	bool bWatching = false;
+
+	/** True if the conditions declared every event that can change their result. */
+	bool bWatchComplete = false;
+
+	/** Result of the last evaluation while watching. */
+	bool bWatchedResult = false;
+
+	/** Set while re-evaluating a watched requirement, sources firing meanwhile only mark it dirty. */
+	bool bInWatchUpdate = false;
+	bool bWatchDirty = false;
+
+	/** True once the conditions went through FlattenForRuntime. */
+	bool bFlattened = false;
+
+	/** True if flattening changed anything, and SwappedConditions holds its result. */
+	bool bHasFlattenedConditions = false;
+
+	/** True while the flattened conditions are swapped into Conditions. */
+	bool bFlattenedInUse = false;
+
+	/**
+	 * The flattened conditions while not in use, the authored ones while they are.
+	 * Flattening works on copies of what it rewrites, so requirements of shared assets keep their authored conditions.
+	 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableCondition>> SwappedConditions;
+
+	/** Context layout the bindings of the conditions were compiled against by the last stateless evaluation. */
+	mutable const UStruct* StatelessLayout = nullptr;
+	mutable bool bStatelessCompiled = false;
+
 	// -------------------------------------------------------------------
 	// API
 	// -------------------------------------------------------------------
@@ -49,9 +170,129 @@ public:
 
 	bool Evaluate() const;
 
-	bool IsEmpty() const { return Conditions.IsEmpty(); }
+	bool IsEmpty() const { return Conditions.IsEmpty() && ConditionNodes.IsEmpty(); }
+
+	/** Returns true if any condition must be evaluated in its authored position. */
+	bool IsOrderSensitive() const;
+
+	/** Returns true if every condition allows its result to be cached. */
+	bool IsCacheable() const;
+
+	/** Returns true if every condition can be evaluated off the game thread (see UScriptableCondition::IsThreadSafe). */
+	bool IsThreadSafe() const;
+
+	/** Returns true if every condition can be evaluated without registering (see UScriptableCondition::SupportsStatelessEvaluation). */
+	bool SupportsStatelessEvaluation() const;
+
+	/**
+	 * Inlines nested groups and requirement assets into Conditions, recursively, wherever the result stays the same:
+	 * same mode and not negated, negated with the opposite mode (children negated, De Morgan), or a single child.
+	 * Groups with their own Context, disabled ones and those a sibling binds to are kept. Assets that can't be inlined
+	 * are replaced by a group holding their copies, built once instead of on every registration.
+	 * Inlined conditions get new binding IDs. Settings of the nested requirements (caching, reordering...) are dropped.
+	 * Modifies the conditions in place, so only call it on runtime copies, never on authored data.
+	 * @return Number of conditions that were inlined, at any depth.
+	 */
+	int32 FlattenConditions();
+
+	/**
+	 * Evaluates on a worker thread (UE::Tasks). Bindings are resolved and the conditions copied now, on the game thread,
+	 * so the Context can change while the task runs. The copies are pooled and given back on the game thread once the task is done.
+	 * Evaluates now instead if a condition is not thread-safe. Caching, reordering and compiled programs are not used.
+	 * @return Task holding the result.
+	 */
+	UE::Tasks::TTask<bool> EvaluateAsync() const;
+
+	/** Same as above, calling OnCompleted with the result on the game thread. */
+	void EvaluateAsync(FOnScriptableRequirementEvaluated OnCompleted) const;
+
+	/** Drops the cached result. Call after changing state the conditions read outside of the Context. */
+	void Invalidate() { CachedFrame = MAX_uint64; }
+
+	/**
+	 * Starts watching: evaluates now, then only when one of the invalidation sources declared by the conditions fires
+	 * (see UScriptableCondition::DeclareInvalidationSources), broadcasting OnResultChanged when the result differs from the last one.
+	 * Must be registered, stops on Unregister. The requirement must not move in memory while watching.
+	 * @return False if some condition can change its result without any source firing. Such changes are only seen
+	 * when another source fires, or on Refresh.
+	 */
+	bool StartWatching();
+
+	void StopWatching();
+
+	bool IsWatching() const { return bWatching; }
+
+	/** Result of the last evaluation while watching. */
+	bool GetWatchedResult() const { return bWatchedResult; }
+
+	/** Re-evaluates a watched requirement now, e.g. after a change that no declared source reports. */
+	void Refresh() { if (bWatching) { HandleWatchInvalidated(); } }
+
+	/**
+	 * Declares the invalidation sources of every enabled condition, after resolving their bindings.
+	 * @return False if any condition can change its result without a source firing.
+	 */
+	bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const;
+
+	/** Statistics of the condition at Index. Only gathered when reordering or with Scriptable.Requirements.Stats enabled. */
+	const FScriptableConditionStats* GetConditionStats(int32 Index) const { return ConditionStats.IsValidIndex(Index) ? &ConditionStats[Index] : nullptr; }
+
+private:
+	/** Evaluates the conditions, ignoring the cached result. */
+	bool EvaluateUncached() const;
+
+	/** Evaluates the conditions in EvaluationOrder, measuring each of them. */
+	bool EvaluateMeasured() const;
+
+	/** Evaluates the condition nodes with the mode of the requirement, without its negation. */
+	bool EvaluateConditionNodes() const;
+
+	/** Registers the enabled condition nodes with the Context passed down to the children. */
+	void RegisterConditionNodes();
+	void UnregisterConditionNodes();
+
+	/** Sorts EvaluationOrder by expected cost to decide the result, without crossing order sensitive conditions. */
+	void ReorderConditions() const;
+
+	void ResetConditionStats() const;
+
+	/** Called when a watched source fires. Re-evaluates, declares the sources again and broadcasts if the result changed. */
+	void HandleWatchInvalidated();
+
+	/**
+	 * Flattens copies of the conditions the first time it is called, if Scriptable.Requirements.Flatten is set and they are not
+	 * authored data, then swaps the result into Conditions until RestoreAuthoredConditions.
+	 */
+	void FlattenForRuntime();
+
+	/** Swaps the authored conditions back in, once the flattened ones are not in use anymore. */
+	void RestoreAuthoredConditions();
+
+	int32 FlattenConditionsInternal(TArray<const UScriptableRequirementAsset*, TInlineAllocator<4>>& AssetStack);
+
+	/** Binds the conditions to the Context for the duration of one evaluation, without registering anything. */
+	bool EvaluateUnregistered(UObject* InOwner);
 
 public:
-	/** Static entry point to evaluate a requirement. */
+	/**
+	 * Static entry point to evaluate a requirement.
+	 * Uses EvaluateStateless, unless Scriptable.Requirements.Stateless is disabled, in which case it registers the requirement for the call.
+	 */
 	static bool EvaluateRequirement(UObject* Owner, const FScriptableRequirement& Requirement);
+
+	/**
+	 * Evaluates a requirement without registering it: no world registration, delegate or binding source map is set up.
+	 * The compiled bindings of the conditions are kept and reused by later calls while the Context layout does not change.
+	 * Registers the requirement for the call instead if a condition does not support it, and just evaluates it if it is already registered.
+	 * Caching and compiled programs are not used.
+	 */
+	static bool EvaluateStateless(UObject* Owner, const FScriptableRequirement& Requirement);
+
+	/**
+	 * Evaluates a requirement once per row of the table, registering it only once.
+	 * The table must have been built from the Context of the requirement (see FScriptableContextTable::Init).
+	 * @param OutResults Receives one bit per row.
+	 * @return False if the table does not match the Context layout, or the requirement has condition nodes. Every result is false then.
+	 */
+	static bool EvaluateBatch(UObject* Owner, const FScriptableRequirement& Requirement, const FScriptableContextTable& Table, TBitArray<>& OutResults);
 };
\ No newline at end of file
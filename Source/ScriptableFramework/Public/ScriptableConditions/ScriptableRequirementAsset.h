@@ -44,6 +44,17 @@ public:
 	virtual void OnRegister() override;
 	virtual void OnUnregister() override;
 
+	virtual bool IsOrderSensitive() const override { return Super::IsOrderSensitive() || (Asset && Asset->Requirement.IsOrderSensitive()); }
+	virtual bool IsCacheable() const override { return Super::IsCacheable() && (!Asset || Asset->Requirement.IsCacheable()); }
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override { return !Condition || Condition->DeclareInvalidationSources(Sources); }
+	virtual bool IsThreadSafe() const override { return !Condition || Condition->CanEvaluateOffGameThread(); }
+
+	/** The runtime group is built from the asset in OnRegister. */
+	virtual bool SupportsStatelessEvaluation() const override { return false; }
+
+	/** Runtime group built from the asset on registration. */
+	UScriptableCondition* GetInstance() const { return Condition; }
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
@@ -0,0 +1,208 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "ScriptableSpatialSubsystem.generated.h"
+
+class AActor;
+class UScriptableSpatialSubsystem;
+
+/**
+ * Spatial hash of points in uniform cubic cells, for radius queries whose cost depends on the local density
+ * instead of the total number of points. Elements are identified by an index chosen by the caller.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableSpatialHash
+{
+	explicit FScriptableSpatialHash(float InCellSize = 1000.0f);
+
+	/** Adds an element. Id must not be in use. */
+	void Add(int32 Id, const FVector& Location);
+
+	void Remove(int32 Id);
+
+	/** Moves an element. Only touches the cells if it changed cell. */
+	void Move(int32 Id, const FVector& Location);
+
+	bool Contains(int32 Id) const { return Elements.IsValidIndex(Id); }
+
+	int32 Num() const { return Elements.Num(); }
+
+	float GetCellSize() const { return CellSize; }
+
+	/**
+	 * Calls Visitor(Id, Location) for every element within Radius of Center (inclusive).
+	 * The visitor returns false to stop the query.
+	 */
+	template<typename FunctorType>
+	void ForEachInRadius(const FVector& Center, float Radius, FunctorType&& Visitor) const
+	{
+		if (Radius < 0.0f || Elements.IsEmpty())
+		{
+			return;
+		}
+
+		const double RadiusSq = FMath::Square(double(Radius));
+		const FIntVector MinCell = GetCell(Center - FVector(Radius));
+		const FIntVector MaxCell = GetCell(Center + FVector(Radius));
+
+		// Radii much larger than the cells would visit mostly empty cells, every element is cheaper then
+		const FIntVector BoxSize = MaxCell - MinCell + FIntVector(1);
+		if (int64(BoxSize.X) * BoxSize.Y * BoxSize.Z > Cells.Num())
+		{
+			for (TSparseArray<FElement>::TConstIterator It(Elements); It; ++It)
+			{
+				if (FVector::DistSquared(Center, It->Location) <= RadiusSq && !Visitor(It.GetIndex(), It->Location))
+				{
+					return;
+				}
+			}
+			return;
+		}
+
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+				{
+					const TArray<int32>* Cell = Cells.Find(FIntVector(X, Y, Z));
+					if (!Cell)
+					{
+						continue;
+					}
+
+					for (const int32 Id : *Cell)
+					{
+						const FVector& Location = Elements[Id].Location;
+						if (FVector::DistSquared(Center, Location) <= RadiusSq && !Visitor(Id, Location))
+						{
+							return;
+						}
+					}
+				}
+			}
+		}
+	}
+
+private:
+	FIntVector GetCell(const FVector& Location) const
+	{
+		return FIntVector(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize), FMath::FloorToInt32(Location.Z * InvCellSize));
+	}
+
+	void AddToCell(int32 Id, const FIntVector& CellCoords);
+	void RemoveFromCell(int32 Id);
+
+	struct FElement
+	{
+		FVector Location;
+		FIntVector Cell;
+
+		/** Position of the element in its cell, for swap removal. */
+		int32 IndexInCell = INDEX_NONE;
+	};
+
+	TSparseArray<FElement> Elements;
+
+	/** Ids of the elements in each occupied cell. Empty cells are removed. */
+	TMap<FIntVector, TArray<int32>> Cells;
+
+	float CellSize;
+	double InvCellSize;
+};
+
+/** Tick function that refreshes the locations of the actors registered in the spatial subsystem, once per frame. */
+USTRUCT()
+struct FScriptableSpatialTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UScriptableSpatialSubsystem* Target = nullptr;
+
+	SCRIPTABLEFRAMEWORK_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	SCRIPTABLEFRAMEWORK_API virtual FString DiagnosticMessage() override;
+	SCRIPTABLEFRAMEWORK_API virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptableSpatialTickFunction> : public TStructOpsTypeTraitsBase2<FScriptableSpatialTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Keeps a spatial hash of the actors registered in a world, one per group (e.g. "Enemy"), for the proximity conditions.
+ * Locations are refreshed at the end of every frame, and only actors that left their cell touch the hash.
+ * Actors are removed when they end play.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableSpatialSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void PostInitialize() override;
+	virtual void Deinitialize() override;
+
+	/** Starts tracking the actor in Group. Registering it again moves it to the new group. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Spatial")
+	void RegisterActor(AActor* Actor, FName Group = NAME_None);
+
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Spatial")
+	void UnregisterActor(AActor* Actor);
+
+	/** Refreshes the location of a registered actor now, e.g. after a teleport, instead of at the end of the frame. */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Spatial")
+	void UpdateActor(AActor* Actor);
+
+	/** Refreshes the locations of every registered actor. */
+	void UpdateLocations();
+
+	/**
+	 * Number of actors of Group within Radius of Center, stopping at MaxCount.
+	 * @param IgnoredActor Not counted, usually the actor asking.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Spatial")
+	int32 CountActorsInRadius(FName Group, FVector Center, float Radius, AActor* IgnoredActor = nullptr, int32 MaxCount = MAX_int32) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Scriptable|Spatial")
+	bool AnyActorInRadius(FName Group, FVector Center, float Radius, AActor* IgnoredActor = nullptr) const { return CountActorsInRadius(Group, Center, Radius, IgnoredActor, 1) > 0; }
+
+	/** Appends the actors of Group within Radius of Center to OutActors. */
+	void FindActorsInRadius(FName Group, const FVector& Center, float Radius, TArray<AActor*>& OutActors, const AActor* IgnoredActor = nullptr) const;
+
+	int32 GetNumActors() const { return Entries.Num(); }
+
+private:
+	UFUNCTION()
+	void HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+
+	void RemoveEntry(int32 Id);
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TObjectKey<AActor> Key;
+		FName Group;
+	};
+
+	FScriptableSpatialTickFunction TickFunction;
+
+	/** Registered actors. Their index is their id in the hash of their group. */
+	TSparseArray<FEntry> Entries;
+
+	TMap<TObjectKey<AActor>, int32> EntryIds;
+
+	TMap<FName, FScriptableSpatialHash> Grids;
+
+	/** Cell size of new grids, from Scriptable.Spatial.CellSize when the world starts. */
+	float CellSize = 1000.0f;
+};
@@ -6,6 +6,8 @@
 #include "StructUtils/PropertyBag.h"
 #include "Core/KzParamDef.h"
 #include "Core/KzPropertyBagHelpers.h"
+#include "Bindings/ScriptableBindingPlan.h"
+#include "ScriptableConditions/ScriptableInvalidationSources.h"
 #include "ScriptableContainer.generated.h"
 
 class UScriptableObject;
@@ -34,6 +36,13 @@ private:
 	UPROPERTY(Transient)
 	TMap<FGuid, TObjectPtr<UScriptableObject>> BindingSourceMap;
 
+	/** Registered children, sorted by SortBindingSources so every object comes after the siblings it reads from. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableObject>> BindingSourceOrder;
+
+	/** Bumped on every write to the Context, so bindings can skip values they already copied. */
+	FScriptableDataVersion ContextVersion;
+
 public:
 	bool HasContext() const { return Context.IsValid(); }
 
@@ -48,8 +57,18 @@ public:
 	void ResetContext()
 	{
 		Context.Reset();
+		MarkContextChanged();
+	}
+
+	/** Must be called after writing to the Context bag directly. Also notifies the requirements watching it. */
+	void MarkContextChanged()
+	{
+		ContextVersion.Bump();
+		FScriptableInvalidationSources::NotifyContextChanged(Context);
 	}
 
+	const FScriptableDataVersion& GetContextVersion() const { return ContextVersion; }
+
 	void ConstructContext();
 
 	template <typename T>
@@ -63,6 +82,7 @@ public:
 	void SetContextProperty(const FName& Name, const T& Value)
 	{
 		KzPropertyBag::Set(Context, Name, Value);
+		MarkContextChanged();
 	}
 
 	template <typename T>
@@ -75,10 +95,22 @@ public:
 	/** Finds a registered object by its persistent ID (used by Property Bindings). */
 	UScriptableObject* FindBindingSource(const FGuid& InID) const;
 
+	/** Registered children in dependency order (sibling binding sources before their consumers). */
+	const TArray<TObjectPtr<UScriptableObject>>& GetBindingSourceOrder() const { return BindingSourceOrder; }
+
 protected:
+	/** Context passed down to the children: the local one if it has properties, otherwise the one of a scriptable owner. */
+	void GetChildContext(const FInstancedPropertyBag*& OutContext, const FScriptableDataVersion*& OutContextVersion) const;
+
 	/** Populates the map and initializes the child with this context. */
 	void AddBindingSource(UScriptableObject* InSource);
 
+	/**
+	 * Builds the dependency graph of the sibling bindings between the registered children and sorts them topologically.
+	 * Assigns each child its binding depth and reports cycles. Call once every child was added.
+	 */
+	void SortBindingSources();
+
 public:
 	/** Initializes the container. */
 	void Register(UObject* InOwner);
@@ -0,0 +1,73 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/PropertyBag.h"
+
+/**
+ * Context values of many agents, stored as one column per Context property (structure of arrays).
+ * Used to evaluate one requirement against all of them at once (see FScriptableRequirement::EvaluateBatch).
+ * Object references stored in the table are not seen by the garbage collector, the caller must keep them alive.
+ */
+struct SCRIPTABLEFRAMEWORK_API FScriptableContextTable
+{
+	struct FColumn
+	{
+		/** Context property stored in this column. */
+		const FProperty* Property = nullptr;
+
+		/** Bytes between two rows. */
+		int32 Stride = 0;
+
+		TArray<uint8, TAlignedHeapAllocator<16>> Data;
+	};
+
+	FScriptableContextTable() = default;
+	~FScriptableContextTable() { Reset(); }
+	UE_NONCOPYABLE(FScriptableContextTable);
+
+	/** Allocates NumRows rows with the layout of the Context, each one initialized to its current values. */
+	void Init(const FInstancedPropertyBag& Defaults, int32 InNumRows);
+
+	void Reset();
+
+	int32 Num() const { return NumRows; }
+
+	/** Layout of the Context the table was built from. */
+	const UPropertyBag* GetLayout() const { return Layout; }
+
+	int32 NumColumns() const { return Columns.Num(); }
+
+	const FColumn& GetColumn(int32 ColumnIndex) const { return Columns[ColumnIndex]; }
+
+	/** Returns the column of the Context property, or INDEX_NONE. */
+	int32 FindColumn(FName PropertyName) const;
+
+	/** Returns the column of the Context property found at this offset of the bag memory, or INDEX_NONE. */
+	int32 FindColumnByOffset(int32 Offset) const;
+
+	/** Values of a column. T must be the C++ type of the property. */
+	template<typename T>
+	TArrayView<T> GetValues(int32 ColumnIndex)
+	{
+		FColumn& Column = Columns[ColumnIndex];
+		check(Column.Stride == sizeof(T));
+		return MakeArrayView(reinterpret_cast<T*>(Column.Data.GetData()), NumRows);
+	}
+
+	template<typename T>
+	TArrayView<T> GetValues(FName PropertyName)
+	{
+		const int32 ColumnIndex = FindColumn(PropertyName);
+		return ColumnIndex != INDEX_NONE ? GetValues<T>(ColumnIndex) : TArrayView<T>();
+	}
+
+	/** Copies the values of a row into the memory of a bag with the table layout. */
+	void CopyRowTo(int32 Row, uint8* BagMemory) const;
+
+private:
+	const UPropertyBag* Layout = nullptr;
+	TArray<FColumn> Columns;
+	int32 NumRows = 0;
+};
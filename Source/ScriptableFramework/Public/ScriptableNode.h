@@ -0,0 +1,84 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StructUtils/StructView.h"
+#include "Bindings/ScriptablePropertyBindings.h"
+#include "ScriptableNode.generated.h"
+
+struct FInstancedPropertyBag;
+struct FScriptableDataVersion;
+
+/** What a struct node works on while registered: the owner of its container and the Context passed down to its children. */
+struct SCRIPTABLEFRAMEWORK_API FScriptableNodeContext
+{
+	UObject* Owner = nullptr;
+	const FInstancedPropertyBag* Context = nullptr;
+	const FScriptableDataVersion* ContextVersion = nullptr;
+
+	UWorld* GetWorld() const;
+};
+
+/**
+ * Base of the struct nodes, the inline counterpart of UScriptableObject.
+ * Nodes are stored by value in TArray<FInstancedStruct> of their container, so copying the container copies them,
+ * with no object to instance, duplicate or collect.
+ * Their property bindings read from the Context of the container. Nodes are not binding sources: they have no binding ID,
+ * and can't bind to the outputs of their siblings.
+ */
+USTRUCT(meta = (Hidden))
+struct SCRIPTABLEFRAMEWORK_API FScriptableNode
+{
+	GENERATED_BODY()
+
+public:
+	FScriptableNode() = default;
+	virtual ~FScriptableNode() = default;
+
+	/** Copies the configuration only, a copy starts unregistered. */
+	FScriptableNode(const FScriptableNode& Other);
+	FScriptableNode& operator=(const FScriptableNode& Other);
+
+	FORCEINLINE bool IsEnabled() const { return bEnabled; }
+	FORCEINLINE bool IsRegistered() const { return bRegistered; }
+
+	/** Binds the node to the Context of its container and compiles its bindings. Self is the view of the node in its container. */
+	void Register(FStructView Self, const FScriptableNodeContext& InNodeContext);
+
+	void Unregister();
+
+	/** Copies the bound values into the node. */
+	void ResolveBindings();
+
+	const FScriptableNodeContext& GetNodeContext() const { return NodeContext; }
+	UObject* GetOwner() const { return NodeContext.Owner; }
+	UWorld* GetWorld() const { return NodeContext.GetWorld(); }
+
+	/** Accessor to add or remove bindings to the Context. */
+	FScriptablePropertyBindings& GetPropertyBindings() { return PropertyBindings; }
+	const FScriptablePropertyBindings& GetPropertyBindings() const { return PropertyBindings; }
+
+protected:
+	virtual void OnRegister() {}
+	virtual void OnUnregister() {}
+
+	/** Configuration: Enabled state */
+	UPROPERTY(EditAnywhere, Category = "Node", meta = (NoBinding))
+	uint8 bEnabled : 1 = true;
+
+	/** Data bindings definition. Only bindings to the Context are resolved. */
+	UPROPERTY(meta = (NoBinding))
+	FScriptablePropertyBindings PropertyBindings;
+
+private:
+	/** Runtime: Registration state */
+	uint8 bRegistered : 1 = false;
+
+	/** Actual type of the node, to view it as a whole when resolving its bindings. */
+	const UScriptStruct* NodeStruct = nullptr;
+
+	FScriptableNodeContext NodeContext;
+
+	FStructView GetSelfView() { return FStructView(NodeStruct, reinterpret_cast<uint8*>(this)); }
+};
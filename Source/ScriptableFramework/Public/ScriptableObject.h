@@ -21,6 +21,9 @@ class SCRIPTABLEFRAMEWORK_API UScriptableObject : public UObject
 	GENERATED_BODY()
 
 	friend class UScriptableCondition;
+	friend class UScriptableBindingSubsystem;
+	friend class UScriptableTickSchedulerSubsystem;
+	friend struct FScriptableContainer;
 
 public:
 	UScriptableObject();
@@ -70,6 +73,15 @@ public:
 	/** Registers an object with a specific world manually. */
 	void RegisterObjectWithWorld(UWorld* InWorld);
 
+	/**
+	 * Binds the object to an owner and runtime data without registering it, for one-shot evaluations (see FScriptableRequirement::EvaluateStateless).
+	 * No world registration, tick function or delegate is set up, and OnRegister is not called. Undo with EndStatelessUse.
+	 */
+	void BeginStatelessUse(UObject* InOwner, const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, const FScriptableDataVersion* InContextVersion);
+
+	/** Releases the owner and runtime data set by BeginStatelessUse. Compiled bindings are kept for the next use. */
+	void EndStatelessUse();
+
 	/** See if this object is currently registered. */
 	FORCEINLINE virtual bool IsRegistered() const { return bRegistered; }
 
@@ -109,6 +121,16 @@ public:
 	FORCEINLINE virtual bool CanEverTick() const { return bCanEverTick; }
 	FORCEINLINE virtual bool IsReadyToTick() const { return true; }
 
+	/** Enables or disables the tick of the object, without unregistering its tick. */
+	UFUNCTION(BlueprintCallable, Category = Tick)
+	void SetTickEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = Tick)
+	bool IsTickEnabled() const;
+
+	/** Returns true if the object is ticked by the tick scheduler of its world rather than by its own tick function. */
+	bool IsTickScheduled() const { return TickSlot.IsValid(); }
+
 protected:
 	/** Virtual call chain to register all tick functions */
 	virtual void RegisterTickFunctions(bool bRegister);
@@ -131,8 +153,14 @@ public:
 	/** Returns the persistent binding ID. */
 	FGuid GetBindingID() const { return BindingID; }
 
+	/**
+	 * Gives each object a new binding ID, and points the sibling bindings between them at the new IDs.
+	 * For objects moved together into another container, where their IDs may already be in use (e.g. the copies of an inlined asset).
+	 */
+	static void RegenerateBindingIDs(TConstArrayView<UScriptableObject*> Objects);
+
 	/** Injects the shared data from the owning container. */
-	virtual void InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap);
+	virtual void InitRuntimeData(const FInstancedPropertyBag* InContext, const TMap<FGuid, TObjectPtr<UScriptableObject>>* InBindingMap, const FScriptableDataVersion* InContextVersion = nullptr);
 
 	/** Propagates the runtime data to a child object. */
 	void PropagateRuntimeData(UScriptableObject* Child) const;
@@ -140,8 +168,26 @@ public:
 	/** Resolves and applies bindings (copies data from sources to this object). */
 	void ResolveBindings();
 
+	/** Resolves only the bindings that must be refreshed before each tick (EveryTick / OnChange policies). */
+	void ResolveTickBindings();
+
+	/** Pre-compiles the bindings against the injected Context and binding sources. */
+	void CompileBindings();
+
+	/** Length of the longest chain of sibling bindings leading to this object (0 if it reads no sibling). */
+	int32 GetBindingDepth() const { return BindingDepth; }
+
 	const FInstancedPropertyBag* GetContext() const { return ContextRef; }
 
+	/** Change stamp of the Context. Null if the context is not versioned, in which case bindings always copy. */
+	const FScriptableDataVersion* GetContextVersion() const { return ContextVersionRef; }
+
+	/** Change stamp of the values this object exposes to sibling bindings. */
+	const FScriptableDataVersion& GetOutputVersion() const { return OutputVersion; }
+
+	/** Must be called after this object writes values read by sibling bindings. Done automatically after running task and condition logic. */
+	void MarkOutputsChanged() { OutputVersion.Bump(); }
+
 	/** Finds a registered task by its persistent ID. */
 	UScriptableObject* FindBindingSource(const FGuid& InID);
 
@@ -177,6 +223,21 @@ private:
 	/** Reference to the Action's Binding Source Map. */
 	const TMap<FGuid, TObjectPtr<UScriptableObject>>* BindingsMapRef = nullptr;
 
+	/** Change stamp of the Context, owned by the container. */
+	const FScriptableDataVersion* ContextVersionRef = nullptr;
+
+	/** Change stamp of the outputs read by sibling bindings. */
+	FScriptableDataVersion OutputVersion;
+
+	/** Set by the owning container when sorting its children. */
+	int32 BindingDepth = 0;
+
+	/** Frame of the last ResolveTickBindings, tick bindings are resolved at most once per frame. */
+	uint64 LastTickResolveFrame = MAX_uint64;
+
+	/** Set by the tick scheduler while it ticks this object. */
+	FScriptableTickSlot TickSlot;
+
 	/** Unique identifier for bindings. Persists across duplication. */
 	UPROPERTY(meta = (NoBinding))
 	FGuid BindingID;
@@ -11,6 +11,19 @@
 
 class UScriptableObject;
 
+/** Place of an object in the tick scheduler of its world (see UScriptableTickSchedulerSubsystem). */
+struct FScriptableTickSlot
+{
+	int32 Group = INDEX_NONE;
+	int32 Bucket = INDEX_NONE;
+	int32 Index = INDEX_NONE;
+
+	/** Whether the object ticks. Can differ from its place in the bucket until the group is done ticking. */
+	bool bEnabled = false;
+
+	bool IsValid() const { return Index != INDEX_NONE; }
+};
+
 /** Tick function that calls UScriptableObject::Tick */
 USTRUCT()
 struct FScriptableObjectTickFunction : public FTickFunction
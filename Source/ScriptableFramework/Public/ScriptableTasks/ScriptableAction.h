@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableContainer.h"
+#include "StructUtils/InstancedStruct.h"
 #include "ScriptableAction.generated.h"
 
 class UScriptableObject;
@@ -49,6 +50,13 @@ public:
 	UPROPERTY(EditAnywhere, Instanced, Category = "Tasks")
 	TArray<TObjectPtr<UScriptableTask>> Tasks;
 
+	/**
+	 * Struct tasks (see FScriptableTaskNode), stored inline and copied with the action, so Clone needs no new objects for them.
+	 * In Sequence mode they run after Tasks. In Parallel mode they begin after Tasks, in the same frame.
+	 */
+	UPROPERTY(EditAnywhere, Category = "Tasks", meta = (BaseStruct = "/Script/ScriptableFramework.ScriptableTaskNode", ExcludeBaseStruct))
+	TArray<FInstancedStruct> TaskNodes;
+
 	FScriptableActionNativeDelegate OnActionBegin;
 	FScriptableActionNativeDelegate OnActionFinish;
 
@@ -67,11 +75,18 @@ private:
 public:
 	/**
 	 * Creates a deep copy of this action and all its sub-tasks.
+	 * Task instances come from the task pool of NewOuter's world when there is one (see UScriptableTaskPoolSubsystem).
 	 * @param NewOuter The object that will own the newly instanced tasks (usually the component running the action).
 	 * @return A fresh, un-registered copy of the action.
 	 */
 	FScriptableAction Clone(UObject* NewOuter) const;
 
+	/**
+	 * Resets a copy made with Clone and gives its tasks back to the task pool. The action has no tasks afterwards.
+	 * Optional, clones that are simply dropped are garbage collected as usual.
+	 */
+	void ReleaseClone();
+
 	/**
 	 * Starts the execution of the action.
 	 * Registers tasks under the hood and begins the flow.
@@ -88,6 +103,9 @@ public:
 	/** Returns true if the action is currently executing. */
 	bool IsRunning() const { return bIsRunning; }
 
+	/** Returns true if the action has neither tasks nor task nodes. */
+	bool IsEmpty() const { return Tasks.IsEmpty() && TaskNodes.IsEmpty(); }
+
 private:
 	/**
 	 * Initializes the action and registers sub-tasks with the owner.
@@ -106,4 +124,10 @@ private:
 
 	void BeginSubTask(UScriptableTask* Task);
 	void OnSubTaskFinished(UScriptableTask* Task);
+
+	/** Begins the task or task node at Index, counting the tasks first. Used in Sequence mode. */
+	void BeginSubTaskAt(int32 Index);
+
+	void BeginTaskNode(FInstancedStruct& Instance);
+	void OnTaskNodeFinished();
 };
\ No newline at end of file
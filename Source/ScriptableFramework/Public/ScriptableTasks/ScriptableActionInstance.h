@@ -0,0 +1,183 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptableContainer.h"
+#include "ScriptableTasks/ScriptableAction.h"
+#include "ScriptableTasks/ScriptableTask.h"
+#include "StructUtils/InstancedStruct.h"
+#include "StructUtils/InstancedStructContainer.h"
+#include "StructUtils/StructView.h"
+#include "ScriptableActionInstance.generated.h"
+
+class UScriptableActionAsset;
+struct FScriptableActionInstance;
+
+/** What a shared task works on while it runs: the run it belongs to and its instance data there. Cheap to copy. */
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskInstanceContext
+{
+	FScriptableTaskInstanceContext(FScriptableActionInstance& InRun, int32 InTaskIndex)
+		: Run(&InRun)
+		, TaskIndex(InTaskIndex)
+	{
+	}
+
+	FScriptableActionInstance& GetRun() const { return *Run; }
+
+	/** Index of the task in the action of the asset. */
+	int32 GetTaskIndex() const { return TaskIndex; }
+
+	/** Instance data of the task in this run, of the type returned by GetInstanceDataType. */
+	FStructView GetInstanceData() const;
+
+	template<typename T>
+	T& GetInstanceData() const { return GetInstanceData().Get<T>(); }
+
+	UObject* GetOwner() const;
+	UWorld* GetWorld() const;
+	const FInstancedPropertyBag& GetContext() const;
+
+	/** Finishes the task in this run, or restarts it if it loops. */
+	void Finish() const;
+
+private:
+	FScriptableActionInstance* Run;
+	int32 TaskIndex;
+};
+
+/** State of one task in a FScriptableActionInstance. Tasks that are copied keep it in their copy instead. */
+struct FScriptableInstanceTaskState
+{
+	/** Index of the task's instance data in the run's buffer, INDEX_NONE if it has none. */
+	int32 InstanceDataIndex = INDEX_NONE;
+
+	int32 LoopIndex = 0;
+
+	EScriptableTaskStatus Status = EScriptableTaskStatus::None;
+
+	bool bDoOnceFinished = false;
+
+	/** True if the task runs from the asset. */
+	bool bShared = false;
+
+	/** Pending restart of a looping shared task with a loop delay. */
+	FScriptableTimerHandle LoopDelayHandle;
+};
+
+/**
+ * A run of the action of an asset that uses the asset's tasks instead of copying them.
+ * Tasks that support shared execution (see UScriptableTask::SupportsSharedExecution) run straight from the asset,
+ * with the state of the run packed in a single instance data buffer. The others (Blueprint tasks, tasks with
+ * property bindings or whose outputs are bound) get their own copy from the task pool, as with FScriptableAction::Clone.
+ * Task nodes are values, every run copies them.
+ * Timers and task delegates refer to a running instance by its address, so it can't be moved, and must not be relocated
+ * (e.g. by a growing TArray) nor destroyed until it is finished or released. Keep instances in stable memory,
+ * such as a member of an object or an array sized before the runs start.
+ */
+USTRUCT(BlueprintType)
+struct SCRIPTABLEFRAMEWORK_API FScriptableActionInstance : public FScriptableContainer
+{
+	GENERATED_BODY()
+
+	friend struct FScriptableTaskInstanceContext;
+
+public:
+	FScriptableActionInstance() = default;
+	~FScriptableActionInstance();
+
+	FScriptableActionInstance(FScriptableActionInstance&&) = delete;
+	FScriptableActionInstance& operator=(FScriptableActionInstance&&) = delete;
+
+	FScriptableActionNativeDelegate OnActionBegin;
+	FScriptableActionNativeDelegate OnActionFinish;
+
+	/**
+	 * Prepares a run of the asset's action: copies its Context, to be filled before Run, and lays out the instance data.
+	 * Initializing with the asset of the previous run keeps everything in place, another asset releases it first.
+	 */
+	void Init(UScriptableActionAsset* InAsset);
+
+	/**
+	 * Starts the run. Copies the tasks that can't be shared the first time, and registers them with the owner.
+	 * @param InOwner The object responsible for running this action (e.g., a Component).
+	 */
+	void Run(UObject* InOwner);
+
+	/** Finishes the run now, finishing the tasks still running. */
+	void Finish();
+
+	/** Finishes the run and resets every task, including the Once tasks that already ran. */
+	void Reset();
+
+	/** Finishes the run, gives the task copies back to the pool and frees the instance data. */
+	void Release();
+
+	bool IsRunning() const { return bIsRunning; }
+
+	UScriptableActionAsset* GetAsset() const { return Asset; }
+
+	/** Number of tasks running from the asset rather than from a copy. */
+	int32 GetNumSharedTasks() const;
+
+	/** Bytes of instance data of this run. */
+	int32 GetInstanceDataSize() const;
+
+private:
+	UPROPERTY(Transient)
+	TObjectPtr<UScriptableActionAsset> Asset;
+
+	/** Copies of the tasks that can't be shared, parallel to the tasks of the asset. Null for the shared ones. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableTask>> TaskCopies;
+
+	/** Instance data of the shared tasks. */
+	UPROPERTY(Transient)
+	FInstancedStructContainer InstanceData;
+
+	/** Copies of the task nodes of the asset. They come after the tasks, their index is offset by the number of tasks. */
+	UPROPERTY(Transient)
+	TArray<FInstancedStruct> TaskNodes;
+
+	/** Parallel to the tasks of the asset. */
+	TArray<FScriptableInstanceTaskState> TaskStates;
+
+	/** The index of the currently running task in Sequence mode, the number of finished tasks in Parallel mode. */
+	int32 CurrentTaskIndex = 0;
+
+	bool bIsRunning = false;
+
+	/** Address the current run started at, to catch instances relocated while running. */
+	const FScriptableActionInstance* RunAddress = nullptr;
+
+	/** True while the task copies are registered. */
+	bool bRegistered = false;
+
+	const UScriptableTask* GetAssetTask(int32 Index) const;
+
+	int32 GetNumSubTasks() const { return TaskStates.Num() + TaskNodes.Num(); }
+
+	/** Returns true if the task can run from the asset. */
+	static bool CanShareTask(const FScriptableAction& Action, const UScriptableTask* Task);
+
+	void Register(UObject* InOwner);
+	void Unregister();
+
+	void CheckAddress() const;
+
+	void BeginSubTask(int32 Index);
+	void FinishSharedTask(int32 Index);
+	static void OnSharedLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex);
+	void OnTaskCopyFinished(UScriptableTask* Task, int32 Index);
+	void OnTaskNodeFinished();
+	void OnSubTaskFinished();
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptableActionInstance> : public TStructOpsTypeTraitsBase2<FScriptableActionInstance>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
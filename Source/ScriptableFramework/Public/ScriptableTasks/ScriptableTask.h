@@ -4,12 +4,15 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableObject.h"
+#include "ScriptableTimerSubsystem.h"
 #include "ScriptableTask.generated.h"
 
 SCRIPTABLEFRAMEWORK_API DECLARE_LOG_CATEGORY_EXTERN(LogScriptableTask, Log, All);
 
 class UScriptableTask;
 class UScriptableCondition;
+class UScriptableTaskPoolSubsystem;
+struct FScriptableTaskInstanceContext;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FScriptableTaskNativeDelegate, UScriptableTask* /*Task*/);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FScriptableTaskDelegate, UScriptableTask*, Task);
@@ -40,6 +43,10 @@ struct FScriptableTaskControl
 	UPROPERTY(EditAnywhere, Category = "Control", meta = (ClampMin = 0))
 	int32 LoopCount = 0;
 
+	/** Seconds to wait before each repetition of a looping task. 0 restarts it right away. */
+	UPROPERTY(EditAnywhere, Category = "Control", meta = (ClampMin = 0, Units = "s"))
+	float LoopDelay = 0.0f;
+
 	/** If true, this task will execute only once during its lifecycle. */
 	UPROPERTY(EditAnywhere, Category = "Control")
 	uint8 bDoOnce : 1 = false;
@@ -50,6 +57,8 @@ class SCRIPTABLEFRAMEWORK_API UScriptableTask : public UScriptableObject
 {
 	GENERATED_BODY()
 
+	friend class UScriptableTaskPoolSubsystem;
+
 private:
 	/** Current status of the task. */
 	EScriptableTaskStatus Status = EScriptableTaskStatus::None;
@@ -66,6 +75,14 @@ private:
 	UPROPERTY(Transient)
 	uint8 bDoOnceFinished : 1 = false;
 
+	/** The task this instance was made from, if it was handed out by the task pool. */
+	TWeakObjectPtr<const UScriptableTask> PoolTemplate;
+
+	/** Pending restart of a looping task with a loop delay. */
+	FScriptableTimerHandle LoopDelayHandle;
+
+	static void OnLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex);
+
 public:
 	EScriptableTaskStatus GetStatus() const { return Status; }
 
@@ -74,7 +91,28 @@ public:
 	/** Indicates that FinishTask has been called */
 	bool HasFinished() const { return Status == EScriptableTaskStatus::Finished; }
 
-	virtual bool IsReadyToTick() const override { return HasBegun(); }
+	/** Indicates that the task is between two iterations of its loop, waiting for the loop delay. */
+	bool IsWaitingToLoop() const { return LoopDelayHandle.IsValid(); }
+
+	virtual bool IsReadyToTick() const override { return HasBegun() && !IsWaitingToLoop(); }
+
+	const FScriptableTaskControl& GetControl() const { return Control; }
+
+	/**
+	 * Returns true if every run of an action asset can use this task directly instead of a copy (see FScriptableActionInstance).
+	 * Such tasks implement BeginShared and FinishShared, which must not modify the task: the state of a run goes in the
+	 * instance data struct returned by GetInstanceDataType. Shared tasks are never registered nor ticked.
+	 */
+	virtual bool SupportsSharedExecution() const { return false; }
+
+	/** Struct holding the state of a shared task for one run, or null if it needs none. */
+	virtual const UScriptStruct* GetInstanceDataType() const { return nullptr; }
+
+	/** Shared counterpart of BeginTask. Call Context.Finish() once done, now or later. */
+	virtual void BeginShared(const FScriptableTaskInstanceContext& Context) const;
+
+	/** Shared counterpart of FinishTask. Also called when the run finishes while the task is running. */
+	virtual void FinishShared(const FScriptableTaskInstanceContext& Context) const {}
 
 	virtual void OnUnregister() override;
 
@@ -103,6 +141,16 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FScriptableTaskDelegate OnTaskFinish;
 
+protected:
+	/**
+	 * Brings a pooled instance back to the state of the template it was made from, so it can be handed out again.
+	 * Called by the task pool on release, while unregistered. Returns false if the instance can't be reused.
+	 * The default copies every property but the registration data, and refuses classes with instanced subobjects
+	 * outside of Transient properties, as a copy would share the template's. Override to clear native state
+	 * (timers, handles, caches) or to reset subobjects.
+	 */
+	virtual bool ResetToTemplate(const UScriptableTask* Template);
+
 private:
 	virtual void ResetTask();
 	virtual void BeginTask();
@@ -0,0 +1,109 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ScriptableNode.h"
+#include "ScriptableTasks/ScriptableTask.h"
+#include "ScriptableTasks/ScriptableTask_Debug.h"
+#include "ScriptableTaskNode.generated.h"
+
+/**
+ * Base of the struct tasks, stored inline in FScriptableAction::TaskNodes.
+ * The inline counterpart of UScriptableTask: no Blueprint subclasses and no tick. Latent nodes finish later
+ * by calling Finish, and must stop what they started in FinishTask, which is also called when the action is finished early.
+ */
+USTRUCT(meta = (Hidden))
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskNode : public FScriptableNode
+{
+	GENERATED_BODY()
+
+public:
+	FScriptableTaskNode() = default;
+	virtual ~FScriptableTaskNode() override = default;
+
+	/** Copies the configuration only, a copy starts idle and unbound. */
+	FScriptableTaskNode(const FScriptableTaskNode& Other);
+	FScriptableTaskNode& operator=(const FScriptableTaskNode& Other);
+
+	/** Executed when the node finishes. Bound by the action running the node. */
+	FSimpleDelegate OnFinished;
+
+	FORCEINLINE bool HasBegun() const { return Status == EScriptableTaskStatus::Begun; }
+	FORCEINLINE bool HasFinished() const { return Status == EScriptableTaskStatus::Finished; }
+
+	const FScriptableTaskControl& GetControl() const { return Control; }
+
+	/** Resolves the bindings and begins the node. Must be registered. */
+	void Begin();
+
+	/** Finishes the node, or restarts it if it loops. */
+	void Finish();
+
+	/** Makes a finished node ready to begin again, including the Once nodes that already ran. */
+	void Reset();
+
+	/** Indicates that the node is between two iterations of its loop, waiting for the loop delay. */
+	bool IsWaitingToLoop() const { return LoopDelayHandle.IsValid(); }
+
+protected:
+	virtual void BeginTask() { Finish(); }
+	virtual void FinishTask() {}
+	virtual void ResetTask() {}
+
+	virtual void OnUnregister() override;
+
+	/** Advanced execution logic (Looping, DoOnce). */
+	UPROPERTY(EditAnywhere, Category = "Node", meta = (NoBinding))
+	FScriptableTaskControl Control;
+
+private:
+	/** Current status of the node. */
+	EScriptableTaskStatus Status = EScriptableTaskStatus::None;
+
+	/** Counter for the current loop iteration. */
+	int32 CurrentLoopIndex = 0;
+
+	/** Runtime flag to track if a DoOnce node has already completed. */
+	uint8 bDoOnceFinished : 1 = false;
+
+	/** Pending restart of a looping node with a loop delay. Its timer points at the node, which doesn't move while registered. */
+	FScriptableTimerHandle LoopDelayHandle;
+
+	static void OnLoopDelayTimer(UObject* Target, void* Payload, int32 PayloadIndex);
+};
+
+/** Struct version of UScriptableTask_LogMessage. */
+USTRUCT(DisplayName = "Log Message (Node)", meta = (TaskCategory = "System|Debug"))
+struct SCRIPTABLEFRAMEWORK_API FScriptableTaskNode_LogMessage : public FScriptableTaskNode
+{
+	GENERATED_BODY()
+
+public:
+	/** The message string to print. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	FString Message = TEXT("Hello");
+
+	/** The severity of the log (affects color and log verbosity). */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	EScriptableLogSeverity Severity = EScriptableLogSeverity::Info;
+
+	/** If true, prints on-screen debug messages. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	bool bPrintToScreen = true;
+
+	/** If true, prints to the UE_LOG output. */
+	UPROPERTY(EditAnywhere, Category = "Config")
+	bool bPrintToLog = true;
+
+	/** Duration for the on-screen message. */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "bPrintToScreen", EditConditionHides))
+	float Duration = 2.0f;
+
+	/** Color override for on-screen message. */
+	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "bPrintToScreen", EditConditionHides))
+	FColor TextColor = FColor::Cyan;
+
+protected:
+	virtual void BeginTask() override;
+};
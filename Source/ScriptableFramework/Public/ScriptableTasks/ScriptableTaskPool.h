@@ -0,0 +1,85 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ScriptableTaskPool.generated.h"
+
+class UScriptableTask;
+
+/** Counters of a task pool since its world started. */
+struct FScriptableTaskPoolStats
+{
+	/** Acquisitions served by a pooled instance. */
+	uint64 Hits = 0;
+
+	/** Acquisitions that had to duplicate the template. */
+	uint64 Misses = 0;
+
+	/** Instances taken back into the pool. */
+	uint64 Releases = 0;
+
+	/** Instances left to the garbage collector on release, because their template is gone, its pool is full or they can't be pooled. */
+	uint64 Discards = 0;
+
+	/** Instances currently waiting in the pool. */
+	int32 NumPooled = 0;
+};
+
+/** Free instances of one template task. */
+USTRUCT()
+struct FScriptableTaskPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableTask>> Instances;
+};
+
+/**
+ * Recycles the task instances of cloned actions and Run Asset tasks instead of duplicating them on every run
+ * and leaving the old ones to the garbage collector.
+ * Instances are pooled per template task, and reset to it when released (see UScriptableTask::ResetToTemplate).
+ * They are created under the pool and stay there for their whole life, their user is only their owner once registered.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableTaskPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+	/**
+	 * Returns an unregistered instance of Template, from the pool if there is one, a copy of Template otherwise.
+	 * Give it back with Release once its user is done with it. Instances that are not given back are simply collected.
+	 */
+	UScriptableTask* Acquire(const UScriptableTask* Template);
+
+	/** Takes back an instance handed out by Acquire. It must be unregistered and no longer referenced by its user. */
+	void Release(UScriptableTask* Instance);
+
+	/** Drops every pooled instance. */
+	void Empty();
+
+	const FScriptableTaskPoolStats& GetStats() const { return Stats; }
+
+	/** Acquires from the pool of Outer's world, or duplicates Template into Outer if there is none or pooling is disabled. */
+	static UScriptableTask* AcquireTask(const UScriptableTask* Template, UObject* Outer);
+
+	/** Releases to the pool the instance came from. Does nothing for instances that didn't come from a pool. */
+	static void ReleaseTask(UScriptableTask* Instance);
+
+private:
+	/** Free instances per template. Templates are not kept alive by the pool, the buckets of collected ones are pruned. */
+	TMap<TObjectKey<UScriptableTask>, FScriptableTaskPoolBucket> Buckets;
+
+	/** Drops the buckets whose template was collected. */
+	void PruneBuckets();
+
+	FScriptableTaskPoolStats Stats;
+};
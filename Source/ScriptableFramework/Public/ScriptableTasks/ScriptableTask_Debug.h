@@ -14,6 +14,12 @@ enum class EScriptableLogSeverity : uint8
 	Error
 };
 
+namespace ScriptableDebug
+{
+	/** Prints a message to the Log and/or Screen, shared by the Log Message task and node. */
+	SCRIPTABLEFRAMEWORK_API void PrintMessage(const FString& Message, EScriptableLogSeverity Severity, bool bPrintToScreen, bool bPrintToLog, float Duration, const FColor& TextColor);
+}
+
 /** Prints a message to the Log and/or Screen. */
 UCLASS(DisplayName = "Log Message", meta = (TaskCategory = "System|Debug"))
 class SCRIPTABLEFRAMEWORK_API UScriptableTask_LogMessage : public UScriptableTask
@@ -45,9 +51,14 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (EditCondition = "bPrintToScreen", EditConditionHides))
 	FColor TextColor = FColor::Cyan;
 
+	virtual bool SupportsSharedExecution() const override { return true; }
+	virtual void BeginShared(const FScriptableTaskInstanceContext& Context) const override;
+
 protected:
 	virtual void BeginTask() override;
 
+	void PrintMessage() const;
+
 public:
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
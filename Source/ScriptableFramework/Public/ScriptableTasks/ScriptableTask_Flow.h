@@ -4,9 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "ScriptableTasks/ScriptableTask.h"
-#include "Engine/TimerHandle.h"
+#include "ScriptableTimerSubsystem.h"
 #include "ScriptableTask_Flow.generated.h"
 
+/** State of a Wait task in a run that shares it (see FScriptableActionInstance). */
+USTRUCT()
+struct FScriptableTask_WaitInstanceData
+{
+	GENERATED_BODY()
+
+	FScriptableTimerHandle TimerHandle;
+};
+
 /**
  * Latent task that waits for a specified amount of time before finishing.
  * Note: This task is primarily intended for 'Sequence' execution mode.
@@ -27,17 +36,31 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Config", meta = (ClampMin = 0))
 	float RandomDeviation = 0.0f;
 
+	virtual bool SupportsSharedExecution() const override { return true; }
+	virtual const UScriptStruct* GetInstanceDataType() const override { return FScriptableTask_WaitInstanceData::StaticStruct(); }
+	virtual void BeginShared(const FScriptableTaskInstanceContext& Context) const override;
+	virtual void FinishShared(const FScriptableTaskInstanceContext& Context) const override;
+
 protected:
 	virtual void BeginTask() override;
+	virtual void FinishTask() override;
 
 	UFUNCTION()
 	void OnWaitFinished();
 
+	/** Duration of one wait, with the random deviation applied. */
+	float GetRandomDuration() const;
+
+	static void OnWaitTimer(UObject* Target, void* Payload, int32 PayloadIndex);
+	static void OnSharedWaitTimer(UObject* Target, void* Payload, int32 PayloadIndex);
+
 public:
+	virtual void OnUnregister() override;
+
 #if WITH_EDITOR
 	virtual FText GetDisplayTitle() const override;
 #endif
 
 private:
-	FTimerHandle TimerHandle;
+	FScriptableTimerHandle TimerHandle;
 };
\ No newline at end of file
@@ -0,0 +1,126 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ScriptableTickScheduler.generated.h"
+
+class AActor;
+class UScriptableObject;
+class UScriptableTickSchedulerSubsystem;
+
+/** Tick function that ticks every scheduled object of one tick group. */
+USTRUCT()
+struct FScriptableTickGroupFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UScriptableTickSchedulerSubsystem* Target = nullptr;
+
+	SCRIPTABLEFRAMEWORK_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	SCRIPTABLEFRAMEWORK_API virtual FString DiagnosticMessage() override;
+	SCRIPTABLEFRAMEWORK_API virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptableTickGroupFunction> : public TStructOpsTypeTraitsBase2<FScriptableTickGroupFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/** Scheduled objects of one class, in one tick group. The enabled ones come first. */
+USTRUCT()
+struct FScriptableTickBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<const UClass> Class;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UScriptableObject>> Objects;
+
+	/** Owner of each object if it is an actor, parallel to Objects. Read for its CustomTimeDilation. */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AActor>> OwnerActors;
+
+	int32 NumEnabled = 0;
+
+	/** Set when objects were added, removed or toggled while their group was ticking. */
+	bool bDirty = false;
+};
+
+/** Scheduled objects of one tick group. */
+USTRUCT()
+struct FScriptableTickGroup
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<FScriptableTickBucket> Buckets;
+
+	int32 NumObjects = 0;
+	int32 NumEnabled = 0;
+};
+
+/**
+ * Ticks the scriptable objects of a world in batches, instead of registering a tick function per object.
+ * Objects are kept in dense buckets per class, and each tick group that has objects gets a single tick function,
+ * which runs after the tick bindings are resolved (see UScriptableBindingSubsystem).
+ * Objects whose tick function needs more than a tick group (an interval, prerequisites, ticking while paused)
+ * keep their own tick function. Disable with Scriptable.Tick.Scheduler 0.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableTickSchedulerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+	friend struct FScriptableTickGroupFunction;
+
+public:
+	virtual void Deinitialize() override;
+
+	/** Returns true if the tick function of the object can be replaced by the scheduler. */
+	static bool CanSchedule(const FTickFunction& TickFunction);
+
+	/** Starts ticking the object with its group. Its enabled state is the one of its tick function. */
+	void AddObject(UScriptableObject* Object);
+
+	/** Stops ticking the object. Safe to call from its own tick. */
+	void RemoveObject(UScriptableObject* Object);
+
+	/** Enables or disables the tick of a scheduled object, keeping its place in the scheduler. */
+	void SetObjectTickEnabled(UScriptableObject* Object, bool bEnabled);
+
+	int32 GetNumObjects() const;
+	int32 GetNumEnabledObjects() const;
+
+	/** Logs the scheduled objects per group and class. */
+	void DumpStats() const;
+
+private:
+	UPROPERTY(Transient)
+	TArray<FScriptableTickGroup> Groups;
+
+	/** One per tick group, registered the first time the group gets an object. Not in an array that can grow, the level keeps pointers to them. */
+	FScriptableTickGroupFunction TickFunctions[TG_MAX];
+
+	/** Group being ticked, INDEX_NONE outside of a tick. Changes to its buckets are deferred until it is done. */
+	int32 TickingGroup = INDEX_NONE;
+
+	void TickScheduledGroup(int32 GroupIndex, float DeltaTime, ELevelTick TickType);
+
+	void RegisterGroupTickFunction(int32 GroupIndex);
+	void UpdateGroupTickFunction(int32 GroupIndex);
+
+	/** Swaps two objects of a bucket, updating their slots. */
+	static void SwapObjects(FScriptableTickBucket& Bucket, int32 IndexA, int32 IndexB);
+
+	/** Drops the objects removed during a tick and moves the enabled ones first again. */
+	static void CompactBucket(FScriptableTickBucket& Bucket);
+};
@@ -0,0 +1,161 @@
+// Copyright 2026 kirzo
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ScriptableTimerSubsystem.generated.h"
+
+class UScriptableTimerSubsystem;
+
+/** Handle to a timer of UScriptableTimerSubsystem. Goes stale once its timer fires or is cleared. */
+struct FScriptableTimerHandle
+{
+	bool IsValid() const { return Serial != 0; }
+	void Invalidate() { Index = INDEX_NONE; Serial = 0; }
+
+private:
+	friend class UScriptableTimerSubsystem;
+
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+};
+
+/** Called when a timer fires, with the target and payload it was set with. Timers of targets that are gone don't fire. */
+using FScriptableTimerFunction = void (*)(UObject* Target, void* Payload, int32 PayloadIndex);
+
+/** Tick function that advances the timer wheel. */
+USTRUCT()
+struct FScriptableTimerTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UScriptableTimerSubsystem* Target = nullptr;
+
+	SCRIPTABLEFRAMEWORK_API virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	SCRIPTABLEFRAMEWORK_API virtual FString DiagnosticMessage() override;
+	SCRIPTABLEFRAMEWORK_API virtual FName DiagnosticContext(bool bDetailed) override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FScriptableTimerTickFunction> : public TStructOpsTypeTraitsBase2<FScriptableTimerTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * Wake-ups for the tasks of a world (Wait, loop delays), on a hierarchical timer wheel instead of FTimerManager.
+ * Setting and clearing a timer is O(1) and binds no delegate: timers call a plain function with a weak target and a payload.
+ * The wheel advances once per frame by the game time, like FTimerManager, and fires every timer that expired during the frame
+ * in order of expiry. Timers fire on the first frame their delay has fully elapsed, never earlier.
+ */
+UCLASS()
+class SCRIPTABLEFRAMEWORK_API UScriptableTimerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void PostInitialize() override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Calls Function(Target, Payload, PayloadIndex) once Delay seconds of game time have passed, unless the timer is cleared or Target is gone.
+	 * The payload must stay valid until the timer fires or is cleared.
+	 */
+	FScriptableTimerHandle SetTimer(float Delay, UObject* Target, FScriptableTimerFunction Function, void* Payload = nullptr, int32 PayloadIndex = 0);
+
+	/** Cancels the timer if it hasn't fired yet, and invalidates the handle. */
+	void ClearTimer(FScriptableTimerHandle& Handle);
+
+	bool IsTimerActive(const FScriptableTimerHandle& Handle) const;
+
+	/** Seconds left before the timer fires, -1 if it is not active. */
+	float GetTimerRemaining(const FScriptableTimerHandle& Handle) const;
+
+	int32 GetNumTimers() const { return NumTimers; }
+
+	/** Advances the wheel by DeltaTime seconds and fires the timers that expired. Called by the tick function. */
+	void Advance(float DeltaTime);
+
+	/** Sets a timer on the subsystem of the target's world. Returns an invalid handle if it has none. */
+	static FScriptableTimerHandle SetTimerFor(UObject* Target, float Delay, FScriptableTimerFunction Function, void* Payload = nullptr, int32 PayloadIndex = 0);
+
+	/** Clears a timer of the subsystem of the object's world, and invalidates the handle. */
+	static void ClearTimerFor(const UObject* WorldContextObject, FScriptableTimerHandle& Handle);
+
+private:
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 SlotMask = NumSlots - 1;
+	static constexpr int32 NumLevels = 5;
+
+	struct FTimer
+	{
+		TWeakObjectPtr<UObject> Target;
+		FScriptableTimerFunction Function = nullptr;
+		void* Payload = nullptr;
+		int32 PayloadIndex = 0;
+
+		/** Wheel tick the timer fires at. */
+		uint64 ExpireTick = 0;
+
+		/** Neighbours in the list of its slot. */
+		int32 Prev = INDEX_NONE;
+		int32 Next = INDEX_NONE;
+
+		/** Slot of the wheel (level * NumSlots + slot), INDEX_NONE once expired and waiting to fire. */
+		int32 Slot = INDEX_NONE;
+
+		/** 0 while the timer is free. */
+		uint32 Serial = 0;
+	};
+
+	struct FExpiredTimer
+	{
+		int32 Index;
+		uint32 Serial;
+	};
+
+	/** Timers by index, handles point here. Free entries are reused. */
+	TArray<FTimer> Timers;
+	TArray<int32> FreeTimers;
+
+	/** First timer of each slot of each level. Level L spans NumSlots^(L+1) ticks. */
+	int32 SlotHeads[NumLevels * NumSlots];
+	int32 NumInLevel[NumLevels];
+
+	/** Timers that expired this frame, fired once the wheel is up to date. */
+	TArray<FExpiredTimer> ExpiredTimers;
+
+	/** Length of a wheel tick, in seconds. */
+	double TickResolution = 0.001;
+
+	/** Game time the wheel has advanced by, and the wheel tick it is at. */
+	double ElapsedTime = 0.0;
+	uint64 CurrentTick = 0;
+
+	uint32 NextSerial = 1;
+	int32 NumTimers = 0;
+
+	FScriptableTimerTickFunction TickFunction;
+
+	const FTimer* FindTimer(const FScriptableTimerHandle& Handle) const;
+
+	/** Puts the timer in the slot of its expiry tick, in the lowest level that reaches it. */
+	void LinkTimer(int32 Index);
+	void UnlinkTimer(int32 Index);
+	void FreeTimer(int32 Index);
+
+	/** Moves the timers of a slot of an upper level down, now that the wheel reached it. */
+	void CascadeSlot(int32 Level, int32 SlotIndex);
+
+	/** Moves the timers of the current level 0 slot to the expired list. */
+	void ExpireCurrentSlot();
+
+	void UpdateTickFunction();
+};
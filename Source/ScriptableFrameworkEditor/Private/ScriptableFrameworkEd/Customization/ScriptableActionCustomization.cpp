@@ -4,6 +4,7 @@
 #include "ScriptableTasks/ScriptableTask.h"
 #include "ScriptableTasks/ScriptableAction.h"
 #include "ScriptableTasks/ScriptableActionAsset.h"
+#include "ScriptableTasks/ScriptableTaskNode.h"
 #include "ScriptableFrameworkEditorStyle.h"
 
 #define LOCTEXT_NAMESPACE "FScriptableActionCustomization"
@@ -18,6 +19,16 @@ FName FScriptableActionCustomization::GetListPropertyName() const
 	return GET_MEMBER_NAME_CHECKED(FScriptableAction, Tasks);
 }
 
+const UScriptStruct* FScriptableActionCustomization::GetBaseScriptStruct() const
+{
+	return FScriptableTaskNode::StaticStruct();
+}
+
+FName FScriptableActionCustomization::GetNodeListPropertyName() const
+{
+	return GET_MEMBER_NAME_CHECKED(FScriptableAction, TaskNodes);
+}
+
 FName FScriptableActionCustomization::GetModePropertyName() const
 {
 	return GET_MEMBER_NAME_CHECKED(FScriptableAction, Mode);
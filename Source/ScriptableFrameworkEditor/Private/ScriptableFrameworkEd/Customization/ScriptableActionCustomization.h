@@ -13,6 +13,8 @@ public:
 protected:
 	virtual UClass* GetBaseClass() const override;
 	virtual FName GetListPropertyName() const override;
+	virtual const UScriptStruct* GetBaseScriptStruct() const override;
+	virtual FName GetNodeListPropertyName() const override;
 	virtual FName GetModePropertyName() const override;
 	virtual FSlateColor GetIconColor() const override;
 	virtual FText GetAddButtonTooltip() const override;
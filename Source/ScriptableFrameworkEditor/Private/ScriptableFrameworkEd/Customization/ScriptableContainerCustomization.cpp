@@ -7,6 +7,7 @@
 
 #include "ScriptableContainer.h"
 #include "ScriptableObjectAsset.h"
+#include "StructUtils/InstancedStruct.h"
 
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
@@ -53,6 +54,9 @@ void FScriptableContainerCustomization::InitCustomization(TSharedRef<IPropertyHa
 	ListHandle = StructHandle->GetChildHandle(GetListPropertyName());
 	ModeHandle = StructHandle->GetChildHandle(GetModePropertyName());
 
+	const FName NodeListName = GetNodeListPropertyName();
+	NodeListHandle = NodeListName.IsNone() ? nullptr : StructHandle->GetChildHandle(NodeListName);
+
 	if (!AddComboButton.IsValid())
 	{
 		FName ClassCategory; FName PropCategory;
@@ -63,6 +67,7 @@ void FScriptableContainerCustomization::InitCustomization(TSharedRef<IPropertyHa
 			.ButtonStyle(FAppStyle::Get(), "SimpleButton")
 			.ToolTipText(GetAddButtonTooltip())
 			.BaseClass(GetBaseClass())
+			.BaseScriptStruct(NodeListHandle.IsValid() ? GetBaseScriptStruct() : nullptr)
 			.ClassCategoryMeta(ClassCategory)
 			.FilterCategoryMeta(PropCategory)
 			.Filter(ScriptableFrameworkEditor::GetPropertyMetaData(StructHandle, PropCategory))
@@ -178,6 +183,15 @@ void FScriptableContainerCustomization::CustomizeChildren(TSharedRef<IPropertyHa
 	ArrayBuilder->OnGenerateArrayElementWidget(FOnGenerateArrayElementWidget::CreateSP(this, &FScriptableContainerCustomization::OnGenerateElement));
 
 	ChildBuilder.AddCustomBuilder(ArrayBuilder);
+
+	// Struct nodes are listed after the objects, as they run after them
+	if (NodeListHandle.IsValid())
+	{
+		TSharedRef<FDetailArrayBuilder> NodeArrayBuilder = MakeShareable(new FDetailArrayBuilder(NodeListHandle.ToSharedRef(), false, false, true));
+		NodeArrayBuilder->OnGenerateArrayElementWidget(FOnGenerateArrayElementWidget::CreateSP(this, &FScriptableContainerCustomization::OnGenerateElement));
+
+		ChildBuilder.AddCustomBuilder(NodeArrayBuilder);
+	}
 }
 
 void FScriptableContainerCustomization::OnGenerateElement(TSharedRef<IPropertyHandle> ElementHandle, int32 Index, IDetailChildrenBuilder& Builder)
@@ -199,8 +213,14 @@ void FScriptableContainerCustomization::ClearElements()
 		uint32 NumElements = 0;
 		ListHandle->AsArray()->GetNumElements(NumElements);
 
-		// Only perform the transaction and empty the array if there are elements to remove
-		if (NumElements > 0)
+		uint32 NumNodes = 0;
+		if (NodeListHandle.IsValid() && NodeListHandle->AsArray().IsValid())
+		{
+			NodeListHandle->AsArray()->GetNumElements(NumNodes);
+		}
+
+		// Only perform the transaction and empty the arrays if there are elements to remove
+		if (NumElements > 0 || NumNodes > 0)
 		{
 			FScopedTransaction Transaction(LOCTEXT("ClearElements", "Clear Container Elements"));
 
@@ -208,6 +228,11 @@ void FScriptableContainerCustomization::ClearElements()
 
 			ListHandle->AsArray()->EmptyArray();
 
+			if (NumNodes > 0)
+			{
+				NodeListHandle->AsArray()->EmptyArray();
+			}
+
 			StructHandle->NotifyPostChange(EPropertyChangeType::ArrayClear);
 
 			if (PropertyUtilities.IsValid())
@@ -391,6 +416,11 @@ void FScriptableContainerCustomization::OnTypePicked(const UStruct* InStruct, co
 		AddElement(PickedClass);
 		bNeedsRefresh = true;
 	}
+	else if (const UScriptStruct* PickedStruct = Cast<UScriptStruct>(InStruct))
+	{
+		AddNode(PickedStruct);
+		bNeedsRefresh = true;
+	}
 
 	if (bNeedsRefresh && PropertyUtilities.IsValid())
 	{
@@ -439,4 +469,36 @@ TSharedPtr<IPropertyHandle> FScriptableContainerCustomization::AddElement(const
 	return NewElementHandle;
 }
 
+TSharedPtr<IPropertyHandle> FScriptableContainerCustomization::AddNode(const UScriptStruct* NodeStruct)
+{
+	if (!NodeListHandle.IsValid() || !NodeStruct) return nullptr;
+
+	FScopedTransaction Transaction(LOCTEXT("AddNode", "Add Node"));
+
+	uint32 NumChildren = 0;
+	NodeListHandle->GetNumChildren(NumChildren);
+	NodeListHandle->AsArray()->AddItem();
+
+	TSharedPtr<IPropertyHandle> NewElementHandle = NodeListHandle->GetChildHandle(NumChildren);
+
+	if (NewElementHandle.IsValid())
+	{
+		StructHandle->NotifyPreChange();
+
+		// The new element is an empty FInstancedStruct in every edited container
+		NewElementHandle->EnumerateRawData([NodeStruct](void* RawData, const int32 /*DataIndex*/, const int32 /*NumDatas*/)
+			{
+				if (RawData)
+				{
+					static_cast<FInstancedStruct*>(RawData)->InitializeAs(NodeStruct);
+				}
+				return true;
+			});
+
+		StructHandle->NotifyPostChange(EPropertyChangeType::ValueSet);
+	}
+
+	return NewElementHandle;
+}
+
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -34,6 +34,12 @@ protected:
 	/** The name of the array property (e.g. "Tasks" or "Conditions"). */
 	virtual FName GetListPropertyName() const = 0;
 
+	/** The struct used for the Picker's struct nodes (e.g. FScriptableTaskNode), or null if the container has none. */
+	virtual const UScriptStruct* GetBaseScriptStruct() const { return nullptr; }
+
+	/** The name of the FInstancedStruct array property holding the struct nodes (e.g. "TaskNodes"). */
+	virtual FName GetNodeListPropertyName() const { return NAME_None; }
+
 	/** The name of the mode property (e.g. "Mode"). */
 	virtual FName GetModePropertyName() const = 0;
 
@@ -60,6 +66,7 @@ protected:
 protected:
 	TSharedPtr<IPropertyHandle> StructHandle;
 	TSharedPtr<IPropertyHandle> ListHandle;
+	TSharedPtr<IPropertyHandle> NodeListHandle;
 	TSharedPtr<IPropertyHandle> ModeHandle;
 
 	TSharedPtr<SComboButton> AddComboButton;
@@ -81,6 +88,9 @@ private:
 	/** Adds a new element of the given class to the array. */
 	TSharedPtr<IPropertyHandle> AddElement(const UClass* ElementClass);
 
+	/** Adds a new struct node of the given type to the node array. */
+	TSharedPtr<IPropertyHandle> AddNode(const UScriptStruct* NodeStruct);
+
 	/** Callback to toggle mode (generic implementation flips the uint8). */
 	FReply OnModeClicked();
 
@@ -4,6 +4,7 @@
 #include "ScriptableConditions/ScriptableCondition.h"
 #include "ScriptableConditions/ScriptableRequirement.h"
 #include "ScriptableConditions/ScriptableRequirementAsset.h"
+#include "ScriptableConditions/ScriptableConditionNode.h"
 #include "ScriptableFrameworkEditorStyle.h"
 
 #define LOCTEXT_NAMESPACE "FScriptableRequirementCustomization"
@@ -50,6 +51,16 @@ FName FScriptableRequirementCustomization::GetListPropertyName() const
 	return GET_MEMBER_NAME_CHECKED(FScriptableRequirement, Conditions);
 }
 
+const UScriptStruct* FScriptableRequirementCustomization::GetBaseScriptStruct() const
+{
+	return FScriptableConditionNode::StaticStruct();
+}
+
+FName FScriptableRequirementCustomization::GetNodeListPropertyName() const
+{
+	return GET_MEMBER_NAME_CHECKED(FScriptableRequirement, ConditionNodes);
+}
+
 FName FScriptableRequirementCustomization::GetModePropertyName() const
 {
 	return GET_MEMBER_NAME_CHECKED(FScriptableRequirement, Mode);
@@ -96,6 +96,15 @@ TSharedPtr<SHorizontalBox> FScriptableTaskCustomization::GetHeaderValueContent()
 			[
 				CountProp->CreatePropertyValueWidget()
 			];
+
+		TSharedPtr<IPropertyHandle> DelayProp = GetControlProperty("LoopDelay");
+		Box->AddSlot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(0, 0, 6, 0)
+			[
+				DelayProp->CreatePropertyValueWidget()
+			];
 	}
 
 	return Box;
@@ -32,6 +32,51 @@ bool UScriptableCondition_MatchTagQuery::Evaluate_Implementation() const
 	return false;
 }
 
+bool UScriptableCondition_MatchTagQuery::DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const
+{
+	const bool bComplete = DeclareBoundContextProperties(Sources);
+
+	if (!IsValid(TargetActor) || TagQuery.IsEmpty())
+	{
+		// Fails until the bound actor or the query changes
+		return bComplete;
+	}
+
+	Sources.AddActorDestroyed(TargetActor);
+
+	UAbilitySystemComponent* AbilitySystemComponent = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(TargetActor);
+	if (!AbilitySystemComponent)
+	{
+		return false;
+	}
+
+	TArray<FGameplayTag> QueryTags;
+	TagQuery.GetGameplayTagArray(QueryTags);
+
+	for (const FGameplayTag& Tag : QueryTags)
+	{
+		Sources.AddCustom([WeakASC = TWeakObjectPtr<UAbilitySystemComponent>(AbilitySystemComponent), Tag](const FSimpleDelegate& OnInvalidated) -> TFunction<void()>
+			{
+				const FDelegateHandle Handle = WeakASC->RegisterGameplayTagEvent(Tag, EGameplayTagEventType::NewOrRemoved).AddLambda(
+					[OnInvalidated](const FGameplayTag, int32)
+					{
+						OnInvalidated.ExecuteIfBound();
+					});
+
+				return [WeakASC, Tag, Handle]()
+					{
+						if (UAbilitySystemComponent* ASC = WeakASC.Get())
+						{
+							ASC->UnregisterGameplayTagEvent(Handle, Tag, EGameplayTagEventType::NewOrRemoved);
+						}
+					};
+			});
+	}
+
+	// Actors implementing the tag interface themselves may own tags the Ability System Component does not report
+	return bComplete && !Cast<IGameplayTagAssetInterface>(TargetActor);
+}
+
 #if WITH_EDITOR
 FText UScriptableCondition_MatchTagQuery::GetDisplayTitle() const
 {
@@ -22,6 +22,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Condition")
 	FGameplayTagQuery TagQuery;
 
+public:
+	/** Context bindings, destruction of the actor, and changes of the queried tags on its Ability System Component. */
+	virtual bool DeclareInvalidationSources(FScriptableInvalidationSources& Sources) const override;
+
 protected:
 	virtual bool Evaluate_Implementation() const override;
 